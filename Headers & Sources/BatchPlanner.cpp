@@ -0,0 +1,221 @@
+// ================================================================================================ Beginning of file "BatchPlanner.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//				BatchPlanner/3 --- An empty batch for the problems of a domain, with the search solving them
+//			   ~BatchPlanner/0 --- Frees the PDDL Problem files read by the batch
+//				 IsAvailable/1 --- Can a search solve a batch?
+//						 Add/1 --- Read a PDDL Problem file into a new job
+//						 Add/1 --- A new job for a problem of the domain
+//					   Solve/1 --- Look a plan up in the cache, or else ground when needed and search
+//						Work/0 --- Solve the next jobs, until there is none
+//						 Run/1 --- Solve all the jobs with a pool of threads, then share the results of identical problems
+//					  SizeOf/0 --- Memory size of the batch
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <chrono>						// Visibility for std::chrono::steady_clock
+#include <thread>						// Visibility for std::thread
+
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"		// Visibility for MEMORY_ALLOCATION, STL, HPHA, CLASSIC
+#endif
+
+#ifndef _SPHG_PLANNER_BATCH_PLANNER_H
+	#include "BatchPlanner.h"				// Class visibility
+#endif
+
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+	#include "RunSearch.h"					// Visibility for NeedstheGroundedOperators/1 and RunSearch/3
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::BatchPlanner/3
+//
+BatchPlanner::BatchPlanner(Domain& aDomain, PDDL::StoreHouse& aStoreHouse, const PDDL::Identifier& aSearch) : theDomain(&aDomain), theStoreHouse(&aStoreHouse), theSearch(aSearch), thePlanCache(0), theNextJob(0), theSnapshot(0) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::~BatchPlanner/0
+//
+// The problems read stay registered with theDomain, which keeps pointers to them: the batch must not
+// be destroyed before theDomain is no longer used.
+//
+BatchPlanner::~BatchPlanner() {
+	for (std::vector<ProblemFile*>::size_type p = 0; p < theProblemFiles.size(); ++p)
+		delete theProblemFiles[p];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::IsAvailable/1
+//
+bool BatchPlanner::IsAvailable(const PDDL::Identifier& aSearch) {
+	return (("breadth" == aSearch) || ("best" == aSearch) || ("astar-hmax" == aSearch) || ("astar-lmcut" == aSearch) || ("gbfs-ff" == aSearch)
+			|| ("iddfs" == aSearch) || ("idastar-hmax" == aSearch) || ("idastar-lmcut" == aSearch) || ("bidirectional" == aSearch));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::Add/1
+//
+BatchPlanner::HJob BatchPlanner::Add(const PDDL::Identifier& aProblemFileName) {
+	ProblemFile* aProblemFile = new ProblemFile(aProblemFileName, *theStoreHouse);
+	theProblemFiles.push_back(aProblemFile);
+
+	if (! aProblemFile->ReadingFailed())
+		return BatchPlanner::Add(theDomain->AddProblem(*aProblemFile));
+
+	// There is no problem to search: the job is done already
+	Job aJob;
+	aJob.theProblem = 0;
+	aJob.theOriginal = (HJob) theJobs.size();
+	theJobs.push_back(aJob);
+
+	Result aResult;
+	aResult.theReadingFailed = true;
+	aResult.thePlanIsFound = false;
+	aResult.theResultIsShared = false;
+	aResult.theStatus = StateSpaceForwardChaining::SEARCH_COMPLETED;
+	aResult.theCost = 0.0f;
+	aResult.theExpansions = 0;
+	aResult.theMicroseconds = 0;
+	theResults.push_back(aResult);
+
+	return aJob.theOriginal;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::Add/1
+//
+BatchPlanner::HJob BatchPlanner::Add(Domain::HProblem aProblem) {
+	Job aJob;
+	aJob.theProblem = aProblem;
+	aJob.theKey = PlanCache::MaketheKey(*theDomain, aProblem);
+	aJob.theOriginal = (HJob) theJobs.size();
+
+	// Only the first of identical problems is searched
+	for (HJob j = 0; j < theJobs.size(); ++j)
+		if (!theResults[j].theReadingFailed && (theJobs[j].theKey == aJob.theKey))
+		{
+			aJob.theOriginal = j;
+			break;
+		}
+	theJobs.push_back(aJob);
+
+	Result aResult;
+	aResult.theReadingFailed = false;
+	aResult.thePlanIsFound = false;
+	aResult.theResultIsShared = false;
+	aResult.theStatus = StateSpaceForwardChaining::SEARCH_COMPLETED;
+	aResult.theCost = 0.0f;
+	aResult.theExpansions = 0;
+	aResult.theMicroseconds = 0;
+	theResults.push_back(aResult);
+
+	return (HJob) (theJobs.size() - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::Solve/1
+//
+// The search structures are built by the thread solving the job: a StateSpaceForwardChaining built
+// on theSnapshot only reads it, and registers with no problem.
+//
+void BatchPlanner::Solve(HJob aJob) {
+	Result& aResult = theResults[aJob];
+	const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+
+	if ((0 != thePlanCache) && thePlanCache->Find(theJobs[aJob].theKey, aResult.thePlan, aResult.theCost))
+	{
+		aResult.thePlanIsFound = true;
+		aResult.theResultIsShared = true;
+		aResult.theMicroseconds = (INTERNAL_TYPES::u64) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStart).count();
+		return;
+	}
+
+	StateSpaceForwardChaining s(*theSnapshot, theJobs[aJob].theProblem);
+	s.SetBudget(theBudget);
+
+	if (!NeedstheGroundedOperators(theSearch) || s.Ground())
+		aResult.thePlanIsFound = RunSearch(s, theSearch);
+
+	aResult.theStatus = s.GettheStatus();
+	aResult.theExpansions = s.GettheExpansions();
+	if (aResult.thePlanIsFound)
+	{
+		s.ConvertthePlanFound(aResult.thePlan);
+		aResult.theCost = s.GettheCostOfthePlanFound();
+		if (0 != thePlanCache)
+			thePlanCache->Insert(theJobs[aJob].theKey, aResult.thePlan, aResult.theCost);
+	}
+	aResult.theMicroseconds = (INTERNAL_TYPES::u64) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStart).count();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::Work/0
+//
+void BatchPlanner::Work() {
+	for (HJob j = theNextJob.fetch_add(1); j < theJobs.size(); j = theNextJob.fetch_add(1))
+		if ((j == theJobs[j].theOriginal) && !theResults[j].theReadingFailed)
+			BatchPlanner::Solve(j);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::Run/1
+//
+void BatchPlanner::Run(unsigned int someThreads) {
+	if (! BatchPlanner::IsAvailable(theSearch))
+		return;
+
+	theNextJob.store(0);
+	const DomainSnapshot aSnapshot(*theDomain);
+	theSnapshot = &aSnapshot;
+
+#if (STL == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+	if (0 == someThreads)
+		someThreads = (0 == std::thread::hardware_concurrency()) ? 1 : std::thread::hardware_concurrency();
+
+	// This thread works in the pool too
+	std::vector<std::thread> theThreads;
+	for (unsigned int t = 1; (t < someThreads) && (t < theJobs.size()); ++t)
+		theThreads.push_back(std::thread(&BatchPlanner::Work, this));
+	BatchPlanner::Work();
+	for (std::vector<std::thread>::size_type t = 0; t < theThreads.size(); ++t)
+		theThreads[t].join();
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION)
+	// These allocators are not thread-safe: this thread alone solves the jobs, in the order they were added
+	(void) someThreads;
+	BatchPlanner::Work();
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+	theSnapshot = 0;
+
+	// The identical problems share the result of the first of them
+	for (HJob j = 0; j < theJobs.size(); ++j)
+		if (j != theJobs[j].theOriginal)
+		{
+			theResults[j] = theResults[theJobs[j].theOriginal];
+			theResults[j].theResultIsShared = true;
+			theResults[j].theExpansions = 0;
+			theResults[j].theMicroseconds = 0;
+		}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// BatchPlanner::SizeOf/0
+//
+size_t BatchPlanner::SizeOf() const {
+	size_t s = sizeof(*this) + theSearch.capacity()
+			 + theProblemFiles.capacity() * sizeof(ProblemFile*)
+			 + theJobs.capacity() * sizeof(Job)
+			 + theResults.capacity() * sizeof(Result);
+	for (std::vector<Job>::size_type j = 0; j < theJobs.size(); ++j)
+		s += theJobs[j].theKey.capacity();
+	for (std::vector<Result>::size_type r = 0; r < theResults.size(); ++r)
+		for (EXTERNAL_TYPES::plan::size_type o = 0; o < theResults[r].thePlan.size(); ++o)
+		{
+			s += sizeof(EXTERNAL_TYPES::op) + theResults[r].thePlan[o].first.capacity();
+			for (EXTERNAL_TYPES::parameters::size_type a = 0; a < theResults[r].thePlan[o].second.size(); ++a)
+				s += sizeof(std::string) + theResults[r].thePlan[o].second[a].capacity();
+		}
+
+	return s;
+}
+
+// ================================================================================================ End of file "BatchPlanner.cpp"
@@ -0,0 +1,138 @@
+// ================================================================================================ Beginning of file "BatchPlanner.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_BATCH_PLANNER_H
+#define _SPHG_PLANNER_BATCH_PLANNER_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <atomic>		// Visibility for std::atomic
+#include <stddef.h>		// Visibility for size_t
+#include <string>		// Visibility for std::string
+#include <vector>		// STL Store house for the problems of the batch and their results
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32 and u64
+#endif
+
+#ifndef _EXTERNAL_TYPES_H
+	#include "ExternalTypes.h"			// Visibility for EXTERNAL_TYPES::plan
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"					// Visibility for Domain and Domain::HProblem
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_SNAPSHOT_H
+	#include "DomainSnapshot.h"			// Visibility for DomainSnapshot
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Identifier, PDDL::Number and PDDL::StoreHouse
+#endif
+
+#ifndef _SPHG_PLANNER_PLAN_CACHE_H
+	#include "PlanCache.h"				// Visibility for PlanCache
+#endif
+
+#ifndef _SPHG_PDDL_PROBLEM_FILE_H
+	#include "ProblemFile.h"			// Visibility for ProblemFile
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"	// Visibility for StateSpaceForwardChaining::Budget and StateSpaceForwardChaining::SearchStatus
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// Many problems of one PDDL Domain, read from PDDL Problem files or built in memory, are solved by a
+// pool of threads with the same search, named as with option -s of the console application; only
+// the searches which use a single thread may solve a batch. The Domain is read once for all the
+// problems, and the problems are read by the thread of the caller, which is the only one to change
+// the Domain; the threads of the pool only read a DomainSnapshot taken by Run/1, without any lock.
+// Identical problems (cf. PlanCache::MaketheKey/2) are searched once: the others share the result.
+// When a PlanCache is given, its plans are used without building any search, and the plans found
+// are stored into it. The results are kept in the order the problems were added.
+//
+class BatchPlanner {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HJob;				// At most 4294967296 problems in a batch
+
+		struct Result {
+			bool								theReadingFailed;	// The PDDL Problem file is incorrect: there is no problem to search
+			bool								thePlanIsFound;
+			bool								theResultIsShared;	// Copied from an identical problem of the batch or from the plan cache: no search was made
+			StateSpaceForwardChaining::SearchStatus	theStatus;		// Why the search stopped
+			EXTERNAL_TYPES::plan				thePlan;
+			PDDL::Number						theCost;
+			INTERNAL_TYPES::u32					theExpansions;
+			INTERNAL_TYPES::u64					theMicroseconds;	// The grounding and the search of the problem
+		};
+
+	private:
+		struct Job {
+			Domain::HProblem					theProblem;
+			std::string							theKey;				// cf. PlanCache::MaketheKey/2
+			HJob								theOriginal;		// The first job of the batch with the same key; this job itself when it is the first
+		};
+
+
+	// ----- Properties
+	private:
+		Domain*									theDomain;			// The PDDL Domain of all the problems...
+		PDDL::StoreHouse*						theStoreHouse;		// ... found in this store house by the PDDL Problem files
+		PDDL::Identifier						theSearch;
+		StateSpaceForwardChaining::Budget		theBudget;			// The limits of the search of each problem
+		PlanCache*								thePlanCache;		// 0 when no cache is used
+		std::vector<ProblemFile*>				theProblemFiles;	// The PDDL Problem files read by Add/1, owned by the batch
+		std::vector<Job>						theJobs;
+		std::vector<Result>						theResults;			// One per job, in the same order
+		std::atomic<HJob>						theNextJob;			// The next job a thread of the pool takes
+		const DomainSnapshot*					theSnapshot;		// What the threads of the pool read from theDomain during Run/1; 0 otherwise
+
+
+	// ----- Constructors
+	public:
+		BatchPlanner(Domain& aDomain, PDDL::StoreHouse& aStoreHouse, const PDDL::Identifier& aSearch);
+
+	private:
+		BatchPlanner(const BatchPlanner&);				// The PDDL Problem files are owned by one batch only...
+		BatchPlanner& operator=(const BatchPlanner&);	// ... and never shared
+
+
+	// ----- Destructor
+	public:
+		~BatchPlanner();
+
+
+	// ----- Accessors
+	public:
+		inline HJob Size() const { return (HJob) theJobs.size(); }
+		inline const Result& GettheResult(HJob aJob) const { return theResults[aJob]; }
+		inline void SetBudget(const StateSpaceForwardChaining::Budget& aBudget) { theBudget = aBudget; }
+		inline void SetPlanCache(PlanCache* aPlanCache) { thePlanCache = aPlanCache; }
+
+
+	// ----- Operations
+	public:
+		static bool IsAvailable(const PDDL::Identifier& aSearch);	// Can aSearch solve a batch?
+
+		HJob Add(const PDDL::Identifier& aProblemFileName);		// Read a PDDL Problem file of theDomain into a new job; its result tells when the reading failed
+		HJob Add(Domain::HProblem aProblem);						// A new job for a problem already in theDomain (e.g. built in memory)
+
+		void Run(unsigned int someThreads = 0);		// Solve all the jobs with someThreads threads (0: as many as the hardware runs concurrently)
+
+		size_t SizeOf() const;
+
+	private:
+		void Solve(HJob aJob);		// Look the plan up in thePlanCache, or else build the search structures, ground when needed, and search
+		void Work();				// The work of one thread of the pool: solve the next original job, until there is none
+};
+
+#endif	// _SPHG_PLANNER_BATCH_PLANNER_H
+// ================================================================================================ End of file "BatchPlanner.h"
@@ -0,0 +1,60 @@
+// ================================================================================================ Beginning of file "DomainSnapshot.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//			  DomainSnapshot/1 --- Copy a PDDL Domain and freeze all its problems
+//					  Freeze/2 --- Copy the identifiers, the predicates, the initial and goal states of a problem
+//					  SizeOf/0 --- Memory size of the frozen problems of the snapshot
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// Project files
+#ifndef _SPHG_PDDL_DOMAIN_SNAPSHOT_H
+	#include "DomainSnapshot.h"				// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// DomainSnapshot::DomainSnapshot/1
+//
+DomainSnapshot::DomainSnapshot(const Domain& aDomain) : Domain(aDomain) {
+	for (Domain::HProblem p = 0; p < aDomain.GettheNumberOfProblems(); ++p)
+		theFrozenProblems.push_back(DomainSnapshot::Freeze(aDomain, p));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// DomainSnapshot::Freeze/2
+//
+DomainSnapshot::FrozenProblem DomainSnapshot::Freeze(const Domain& aDomain, Domain::HProblem aProblem) {
+	const Problem& aPDDLProblem = *aDomain.GettheProblem(aProblem);
+	FrozenProblem aFrozenProblem;
+
+	// The table of string constants
+	for (std::map<PDDL::HIdentifier, PDDL::Identifier>::const_iterator i = aPDDLProblem.GettheConstants().begin(); i != aPDDLProblem.GettheConstants().end(); ++i)
+		aFrozenProblem.theIdentifiers.push_back(i->second);
+
+	// The predicates of the domain, then those of the problem
+	aFrozenProblem.thePredicates = aDomain.GetthePredicates();
+	aFrozenProblem.thePredicates.insert(aFrozenProblem.thePredicates.end(), aPDDLProblem.GetthePredicates().begin(), aPDDLProblem.GetthePredicates().end());
+
+	aFrozenProblem.thePositiveInitialState = aPDDLProblem.GetthePositiveInitialState();
+	aFrozenProblem.thePositiveGoalState = aPDDLProblem.GetthePositiveGoalState();
+
+	return aFrozenProblem;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// DomainSnapshot::SizeOf/0
+//
+size_t DomainSnapshot::SizeOf() const {
+	size_t s = sizeof(*this) + theFrozenProblems.capacity() * sizeof(FrozenProblem);
+	for (std::vector<FrozenProblem>::size_type p = 0; p < theFrozenProblems.size(); ++p)
+	{
+		for (std::vector<PDDL::Identifier>::size_type i = 0; i < theFrozenProblems[p].theIdentifiers.size(); ++i)
+			s += sizeof(PDDL::Identifier) + theFrozenProblems[p].theIdentifiers[i].capacity();
+		for (std::vector<Predicate>::size_type i = 0; i < theFrozenProblems[p].thePredicates.size(); ++i)
+			s += theFrozenProblems[p].thePredicates[i].SizeOf();
+	}
+
+	return s;
+}
+
+// ================================================================================================ End of file "DomainSnapshot.cpp"
@@ -0,0 +1,85 @@
+// ================================================================================================ Beginning of file "DomainSnapshot.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PDDL_DOMAIN_SNAPSHOT_H
+#define _SPHG_PDDL_DOMAIN_SNAPSHOT_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the frozen problems, their identifiers and their predicates
+
+// Project files
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"					// Visibility for Domain and Domain::HProblem
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Identifier
+#endif
+
+#ifndef _SPHG_PLANNER_PREDICATE_H
+	#include "Predicate.h"
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for TemporaryState
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// A copy of a PDDL Domain and of what the searches read from its problems, taken once by a single
+// thread and never changed afterwards: the Domain and its problems may then be changed (e.g. new
+// problems added) while searches read the snapshot. Only const accesses to the copied Domain are
+// given, and a StateSpaceForwardChaining built on a snapshot does not register with the Problem it
+// searches (cf. Problem::Register/1): any number of threads may build and run such searches at once,
+// without locks, as long as the snapshot lives longer than them.
+//
+// Each frozen problem holds the predicates of the domain followed by those of the problem, merged once
+// for all the searches of the problem: a search only copies them into the table it extends with the
+// predicates it instantiates.
+//
+class DomainSnapshot : private Domain {
+	// ----- Types
+	public:
+		struct FrozenProblem {
+			std::vector<PDDL::Identifier>		theIdentifiers;				// The constants of the domain and of the problem, ordered by their PDDL::HIdentifier
+			std::vector<Predicate>				thePredicates;				// The predicates of the domain followed by the predicates of the problem
+			TemporaryState						thePositiveInitialState;
+			TemporaryState						thePositiveGoalState;
+		};
+
+
+	// ----- Properties
+	private:
+		std::vector<FrozenProblem>				theFrozenProblems;			// One per problem of the Domain when the snapshot was taken, in the same order
+
+
+	// ----- Constructors
+	public:
+		explicit DomainSnapshot(const Domain& aDomain);
+
+	private:
+		DomainSnapshot(const DomainSnapshot&);				// A snapshot is never copied...
+		DomainSnapshot& operator=(const DomainSnapshot&);	// ... but shared
+
+
+	// ----- Accessors
+	public:
+		inline const Domain& GettheDomain() const { return *this; }
+		inline Domain::HProblem GettheNumberOfProblems() const { return (Domain::HProblem) theFrozenProblems.size(); }
+		inline const FrozenProblem& GettheFrozenProblem(Domain::HProblem aProblem) const { return theFrozenProblems[aProblem]; }
+
+
+	// ----- Operations
+	public:
+		static FrozenProblem Freeze(const Domain& aDomain, Domain::HProblem aProblem);	// Copy what the searches read from aProblem of aDomain
+
+		size_t SizeOf() const;
+};
+
+#endif	// _SPHG_PDDL_DOMAIN_SNAPSHOT_H
+// ================================================================================================ End of file "DomainSnapshot.h"
@@ -0,0 +1,179 @@
+// ================================================================================================ Beginning of file "FF.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//						  FF/2 --- Size the h_add and relaxed plan structures
+//					 Explore/1 --- Dijkstra-like computation of the h_add costs and best supporters of the predicates from a state
+//					Evaluate/1 --- Extract a relaxed plan from the best supporters; its cost is the estimate
+//					  SizeOf/0 --- Memory size of the heuristic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::sort
+
+// Project files
+#ifndef _SPHG_PLANNER_FF_H
+	#include "FF.h"						// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const GroundedAction::HAction FF::NO_SUPPORTER;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// FF::FF/2
+//
+FF::FF(const GroundedActions& someGroundedActions, const State& aGoal) :
+	Heuristic(someGroundedActions, aGoal),
+	thePredicateCosts(State::end(), DEAD_END),
+	theBestSupporters(State::end(), NO_SUPPORTER),
+	theActionCosts(theRelaxedActions.size()),
+	theUnsatisfied(theRelaxedActions.size()),
+	theMarkedPredicates(State::end(), false),
+	theRelaxedPlan(theRelaxedActions.size(), false) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// FF::Explore/1
+//
+// The predicates leave theQueue by increasing costs: when the last precondition of a relaxed action
+// leaves theQueue, theActionCosts of this action is the sum of the costs of all its preconditions.
+//
+void FF::Explore(const State& aState) {
+	thePredicateCosts.assign(State::end(), DEAD_END);
+	theBestSupporters.assign(State::end(), NO_SUPPORTER);
+	for (std::vector<RelaxedAction>::size_type a = 0; a < theRelaxedActions.size(); ++a)
+	{
+		theActionCosts[a] = theRelaxedActions[a].theCost;
+		theUnsatisfied[a] = (State::index_type) theRelaxedActions[a].thePreconditions.size();
+	}
+
+	// The predicates of aState cost nothing...
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+	{
+		thePredicateCosts[i] = 0.0f;
+		theQueue.push(PredicateWithCost(0.0f, (PDDL::HPredicate) i));
+	}
+	// ... and the relaxed actions without preconditions are always applicable
+	for (std::vector<GroundedAction::HAction>::size_type n = 0; n < theActionsWithoutPreconditions.size(); ++n)
+	{
+		const GroundedAction::HAction a = theActionsWithoutPreconditions[n];
+		for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+		{
+			const PDDL::HPredicate p = theRelaxedActions[a].theAdditions[q];
+			if (theActionCosts[a] < thePredicateCosts[p])
+			{
+				thePredicateCosts[p] = theActionCosts[a];
+				theBestSupporters[p] = a;
+				theQueue.push(PredicateWithCost(theActionCosts[a], p));
+			}
+		}
+	}
+
+	while (! theQueue.empty())
+	{
+		const PredicateWithCost top = theQueue.top();
+		theQueue.pop();
+
+		// Skip this predicate when a cheaper cost has already been found for it
+		if (top.first > thePredicateCosts[top.second])
+			continue;
+
+		const std::vector<GroundedAction::HAction>& someActions = thePreconditionOf[top.second];
+		for (std::vector<GroundedAction::HAction>::size_type n = 0; n < someActions.size(); ++n)
+		{
+			const GroundedAction::HAction a = someActions[n];
+			theActionCosts[a] += top.first;
+			if (0 == --theUnsatisfied[a])
+			{
+				// All the preconditions of this relaxed action are reached
+				for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+				{
+					const PDDL::HPredicate p = theRelaxedActions[a].theAdditions[q];
+					if (theActionCosts[a] < thePredicateCosts[p])
+					{
+						thePredicateCosts[p] = theActionCosts[a];
+						theBestSupporters[p] = a;
+						theQueue.push(PredicateWithCost(theActionCosts[a], p));
+					}
+				}
+			}
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// FF::Evaluate/1
+//
+PDDL::Number FF::Evaluate(const State& aState) {
+	thePreferredActions.clear();
+
+	FF::Explore(aState);
+	for (std::vector<PDDL::HPredicate>::size_type g = 0; g < theGoal.size(); ++g)
+		if (DEAD_END == thePredicateCosts[theGoal[g]])
+			return DEAD_END;
+
+	// Mark the predicates of theGoal which are not in aState...
+	theMarkedPredicates.assign(State::end(), false);
+	for (std::vector<PDDL::HPredicate>::size_type g = 0; g < theGoal.size(); ++g)
+		if (! aState.find(theGoal[g]) && !theMarkedPredicates[theGoal[g]])
+		{
+			theMarkedPredicates[theGoal[g]] = true;
+			theStack.push_back(theGoal[g]);
+		}
+
+	// ... and support them backward with their best supporters: these supporters make the relaxed plan
+	std::vector<GroundedAction::HAction> someRelaxedActions;
+	PDDL::Number h = 0.0f;
+	while (! theStack.empty())
+	{
+		const PDDL::HPredicate p = theStack.back();
+		theStack.pop_back();
+
+		const GroundedAction::HAction a = theBestSupporters[p];
+		if (theRelaxedPlan[a])
+			continue;
+		theRelaxedPlan[a] = true;
+		someRelaxedActions.push_back(a);
+		h += theRelaxedActions[a].theCost;
+
+		// The relaxed actions of the relaxed plan whose preconditions are all in aState are the preferred actions
+		bool anActionIsApplicable = true;
+		for (std::vector<PDDL::HPredicate>::size_type n = 0; n < theRelaxedActions[a].thePreconditions.size(); ++n)
+		{
+			const PDDL::HPredicate q = theRelaxedActions[a].thePreconditions[n];
+			if (! aState.find(q))
+			{
+				anActionIsApplicable = false;
+				if (! theMarkedPredicates[q])
+				{
+					theMarkedPredicates[q] = true;
+					theStack.push_back(q);
+				}
+			}
+		}
+		if (anActionIsApplicable)
+			thePreferredActions.push_back(a);
+	}
+
+	// Forget the relaxed plan for the next evaluation
+	for (std::vector<GroundedAction::HAction>::size_type n = 0; n < someRelaxedActions.size(); ++n)
+		theRelaxedPlan[someRelaxedActions[n]] = false;
+
+	std::sort(thePreferredActions.begin(), thePreferredActions.end());
+
+	return h;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// FF::SizeOf/0
+//
+size_t FF::SizeOf() const {
+	return (Heuristic::SizeOf() - sizeof(Heuristic) + sizeof(*this)
+			+ thePredicateCosts.capacity() * sizeof(PDDL::Number)
+			+ theBestSupporters.capacity() * sizeof(GroundedAction::HAction)
+			+ theActionCosts.capacity() * sizeof(PDDL::Number)
+			+ theUnsatisfied.capacity() * sizeof(State::index_type)
+			+ (theMarkedPredicates.capacity() + theRelaxedPlan.capacity()) / 8
+			+ theStack.capacity() * sizeof(PDDL::HPredicate));
+}
+
+// ================================================================================================ End of file "FF.cpp"
@@ -0,0 +1,66 @@
+// ================================================================================================ Beginning of file "FF.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_FF_H
+#define _SPHG_PLANNER_FF_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <functional>	// Visibility for std::greater
+#include <queue>		// STL Store house for the predicates waiting for their final cost
+#include <utility>		// Visibility for std::pair
+#include <vector>		// STL Store house for the costs, the best supporters and the relaxed plan
+
+// Project files
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+	#include "Heuristic.h"				// Visibility for Heuristic
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// The FF heuristic (Hoffmann & Nebel, 2001): the cost of a relaxed plan extracted backward from the
+// goal with the best supporters of an h_add computation. The actions of this relaxed plan which are
+// applicable to the evaluated State are its preferred actions (the "helpful actions" of FF).
+// FF is not admissible: it is meant for greedy searches.
+//
+class FF : public Heuristic {
+	// ----- Types
+	private:
+		typedef		std::pair<PDDL::Number, PDDL::HPredicate>		PredicateWithCost;
+		typedef		std::priority_queue<PredicateWithCost, std::vector<PredicateWithCost>, std::greater<PredicateWithCost> >	PredicatesWithCosts;	// Its top() predicate has the lowest cost
+
+		static const GroundedAction::HAction NO_SUPPORTER = 0xFFFFFFFF;	// The best supporter of a predicate of the evaluated State, or of an unreached predicate
+
+
+	// ----- Properties
+	private:
+		std::vector<PDDL::Number>				thePredicateCosts;			// The h_add cost of each predicate; DEAD_END when unreached
+		std::vector<GroundedAction::HAction>	theBestSupporters;			// For each predicate, the relaxed action reaching it with the lowest h_add cost
+		std::vector<PDDL::Number>				theActionCosts;				// For each relaxed action, its cost plus the h_add costs of its preconditions reached so far
+		std::vector<State::index_type>			theUnsatisfied;				// For each relaxed action, the number of its preconditions not reached yet
+		PredicatesWithCosts						theQueue;					// The reached predicates waiting for their final cost
+
+		std::vector<bool>						theMarkedPredicates;		// The predicates the relaxed plan shall reach
+		std::vector<bool>						theRelaxedPlan;				// The relaxed actions of the relaxed plan
+		std::vector<PDDL::HPredicate>			theStack;					// The marked predicates yet to support
+
+
+	// ----- Constructors
+	public:
+		FF(const GroundedActions& someGroundedActions, const State& aGoal);
+
+
+	// ----- Operations
+	public:
+		virtual PDDL::Number Evaluate(const State& aState);
+		virtual size_t SizeOf() const;
+
+	private:
+		void Explore(const State& aState);	// Compute thePredicateCosts and theBestSupporters from aState
+};
+
+#endif	// _SPHG_PLANNER_FF_H
+// ================================================================================================ End of file "FF.h"
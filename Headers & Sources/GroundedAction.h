@@ -0,0 +1,99 @@
+// ================================================================================================ Beginning of file "GroundedAction.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+#define _SPHG_PLANNER_GROUNDED_ACTION_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <vector>		// STL Store house for the grounded actions
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Number
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"					// Visibility for Domain::HOperator
+#endif
+
+#ifndef _SPHG_PLANNER_OPERATOR_H
+	#include "Operator.h"				// Visibility for Operator::HOperatorSignature
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// An Operator of the domain whose parameters all have a value: its preconditions, negative
+// preconditions, deletions and additions are masks of shared predicates, so that checking whether
+// it applies to a State and applying it to this State are a few operations on 64 bits slots.
+//
+class GroundedAction {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HAction;			// At most 4294967296 grounded actions; a HAction is a position in GroundedActions
+
+		static const HAction NO_ACTION = 0xFFFFFFFF;				// Means "no such grounded action"
+
+
+	// ----- Properties
+	private:
+		State									thePreconditions;			// The (positive) preconditions which must all be in a State
+		State									theNegativePreconditions;	// The negative preconditions which must all be absent from a State
+		State									theDeletions;				// The deleted preconditions and the deletions
+		State									theAdditions;				// The additions
+		Domain::HOperator						theOperator;				// The Operator of the domain this action is an instance of
+		Operator::HOperatorSignature			theOperatorSignature;		// The name and parameters of this action, in theSharedOperatorSignatures of the search
+		PDDL::Number							theCost;					// The (:action-costs) numeric cost of theOperator
+
+
+	// ----- Constructors
+	public:
+		GroundedAction(Domain::HOperator anOperator, Operator::HOperatorSignature anOperatorSignature, PDDL::Number aCost) :
+			theOperator(anOperator),
+			theOperatorSignature(anOperatorSignature),
+			theCost(aCost) {}
+
+
+	// ----- Accessors
+	public:
+		inline const State& GetthePreconditions() const { return thePreconditions; }
+		inline const State& GettheNegativePreconditions() const { return theNegativePreconditions; }
+		inline const State& GettheDeletions() const { return theDeletions; }
+		inline const State& GettheAdditions() const { return theAdditions; }
+		inline Domain::HOperator GettheOperator() const { return theOperator; }
+		inline Operator::HOperatorSignature GettheOperatorSignature() const { return theOperatorSignature; }
+		inline PDDL::Number GettheCost() const { return theCost; }
+
+		inline void AddPrecondition(PDDL::HPredicate aPredicate) { thePreconditions.insert(aPredicate); }
+		inline void AddNegativePrecondition(PDDL::HPredicate aPredicate) { theNegativePreconditions.insert(aPredicate); }
+		inline void AddDeletion(PDDL::HPredicate aPredicate) { theDeletions.insert(aPredicate); }
+		inline void AddAddition(PDDL::HPredicate aPredicate) { theAdditions.insert(aPredicate); }
+
+
+	// ----- Operations
+	public:
+		inline bool IsApplicableTo(const State& aState) const {
+			return (aState.includes(thePreconditions) && !aState.intersects(theNegativePreconditions));
+		}
+		inline void Apply(State& aState) const {
+			// Deletions first, additions last: aState = (aState AND NOT theDeletions) OR theAdditions
+			aState.remove(theDeletions);
+			aState.add(theAdditions);
+		}
+};
+
+typedef		std::vector<GroundedAction>		GroundedActions;	// All the grounded actions of a problem, one after the other
+
+#endif	// _SPHG_PLANNER_GROUNDED_ACTION_H
+// ================================================================================================ End of file "GroundedAction.h"
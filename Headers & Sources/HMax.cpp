@@ -0,0 +1,120 @@
+// ================================================================================================ Beginning of file "HMax.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//						HMax/2 --- Memorize the costs of the relaxed actions
+//					 Explore/2 --- Dijkstra-like computation of the h_max costs of the predicates from a state
+//					Evaluate/1 --- The h_max cost of the goal from a state
+//					  SizeOf/0 --- Memory size of the heuristic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+#ifndef _SPHG_PLANNER_HMAX_H
+	#include "HMax.h"					// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// HMax::HMax/2
+//
+HMax::HMax(const GroundedActions& someGroundedActions, const State& aGoal) :
+	Heuristic(someGroundedActions, aGoal),
+	thePredicateCosts(State::end(), DEAD_END),
+	theUnsatisfied(theRelaxedActions.size()),
+	theSupporters(theRelaxedActions.size(), State::end()),
+	theActionCosts(theRelaxedActions.size()) {
+
+	for (std::vector<RelaxedAction>::size_type a = 0; a < theRelaxedActions.size(); ++a)
+		theActionCosts[a] = theRelaxedActions[a].theCost;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// HMax::Explore/2
+//
+// The predicates leave theQueue by increasing costs: when the last precondition of a relaxed action
+// leaves theQueue, its cost is the highest of all the preconditions of this action.
+//
+PDDL::Number HMax::Explore(const State& aState, const std::vector<PDDL::Number>& someActionCosts) {
+	thePredicateCosts.assign(State::end(), DEAD_END);
+	theSupporters.assign(theRelaxedActions.size(), State::end());
+	for (std::vector<RelaxedAction>::size_type a = 0; a < theRelaxedActions.size(); ++a)
+		theUnsatisfied[a] = (State::index_type) theRelaxedActions[a].thePreconditions.size();
+
+	// The predicates of aState cost nothing...
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+	{
+		thePredicateCosts[i] = 0.0f;
+		theQueue.push(PredicateWithCost(0.0f, (PDDL::HPredicate) i));
+	}
+	// ... and the relaxed actions without preconditions are always applicable
+	for (std::vector<GroundedAction::HAction>::size_type n = 0; n < theActionsWithoutPreconditions.size(); ++n)
+	{
+		const GroundedAction::HAction a = theActionsWithoutPreconditions[n];
+		const PDDL::Number aCost = someActionCosts[a];
+		for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+		{
+			const PDDL::HPredicate p = theRelaxedActions[a].theAdditions[q];
+			if (aCost < thePredicateCosts[p])
+			{
+				thePredicateCosts[p] = aCost;
+				theQueue.push(PredicateWithCost(aCost, p));
+			}
+		}
+	}
+
+	while (! theQueue.empty())
+	{
+		const PredicateWithCost top = theQueue.top();
+		theQueue.pop();
+
+		// Skip this predicate when a cheaper cost has already been found for it
+		if (top.first > thePredicateCosts[top.second])
+			continue;
+
+		const std::vector<GroundedAction::HAction>& someActions = thePreconditionOf[top.second];
+		for (std::vector<GroundedAction::HAction>::size_type n = 0; n < someActions.size(); ++n)
+		{
+			const GroundedAction::HAction a = someActions[n];
+			if (0 == --theUnsatisfied[a])
+			{
+				// All the preconditions of this relaxed action are reached: top.second is the most expensive one
+				theSupporters[a] = top.second;
+				const PDDL::Number aCost = top.first + someActionCosts[a];
+				for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+				{
+					const PDDL::HPredicate p = theRelaxedActions[a].theAdditions[q];
+					if (aCost < thePredicateCosts[p])
+					{
+						thePredicateCosts[p] = aCost;
+						theQueue.push(PredicateWithCost(aCost, p));
+					}
+				}
+			}
+		}
+	}
+
+	// The cost of theGoal is the cost of its most expensive predicate
+	PDDL::Number aGoalCost = 0.0f;
+	for (std::vector<PDDL::HPredicate>::size_type g = 0; g < theGoal.size(); ++g)
+		if (aGoalCost < thePredicateCosts[theGoal[g]])
+			aGoalCost = thePredicateCosts[theGoal[g]];
+
+	return aGoalCost;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// HMax::Evaluate/1
+//
+PDDL::Number HMax::Evaluate(const State& aState) {
+	return HMax::Explore(aState, theActionCosts);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// HMax::SizeOf/0
+//
+size_t HMax::SizeOf() const {
+	return (Heuristic::SizeOf() - sizeof(Heuristic) + sizeof(*this)
+			+ thePredicateCosts.capacity() * sizeof(PDDL::Number)
+			+ theUnsatisfied.capacity() * sizeof(State::index_type)
+			+ theSupporters.capacity() * sizeof(State::index_type)
+			+ theActionCosts.capacity() * sizeof(PDDL::Number));
+}
+
+// ================================================================================================ End of file "HMax.cpp"
@@ -0,0 +1,62 @@
+// ================================================================================================ Beginning of file "HMax.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_HMAX_H
+#define _SPHG_PLANNER_HMAX_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <functional>	// Visibility for std::greater
+#include <queue>		// STL Store house for the predicates waiting for their final cost
+#include <utility>		// Visibility for std::pair
+#include <vector>		// STL Store house for the costs of the predicates and of the relaxed actions
+
+// Project files
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+	#include "Heuristic.h"				// Visibility for Heuristic
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// The h_max heuristic: the cost of a set of predicates is the cost of its most expensive predicate,
+// and the cost of a predicate is the cheapest cost of an action adding it. h_max is admissible.
+//
+class HMax : public Heuristic {
+	// ----- Types
+	protected:
+		typedef		std::pair<PDDL::Number, PDDL::HPredicate>		PredicateWithCost;
+		typedef		std::priority_queue<PredicateWithCost, std::vector<PredicateWithCost>, std::greater<PredicateWithCost> >	PredicatesWithCosts;	// Its top() predicate has the lowest cost
+
+
+	// ----- Properties
+	protected:
+		std::vector<PDDL::Number>				thePredicateCosts;			// The h_max cost of each predicate; DEAD_END when unreached
+		std::vector<State::index_type>			theUnsatisfied;				// For each relaxed action, the number of its preconditions not reached yet
+		std::vector<State::index_type>			theSupporters;				// For each reached relaxed action, its precondition with the highest cost; State::end() when there is none
+		PredicatesWithCosts						theQueue;					// The reached predicates waiting for their final cost
+
+	private:
+		std::vector<PDDL::Number>				theActionCosts;				// The costs of the relaxed actions, for Evaluate/1
+
+
+	// ----- Constructors
+	public:
+		HMax(const GroundedActions& someGroundedActions, const State& aGoal);
+
+
+	// ----- Operations
+	public:
+		virtual PDDL::Number Evaluate(const State& aState);
+		virtual size_t SizeOf() const;
+
+	protected:
+		// Compute thePredicateCosts and theSupporters from aState, with someActionCosts as the costs of the relaxed actions;
+		// return the h_max cost of theGoal
+		PDDL::Number Explore(const State& aState, const std::vector<PDDL::Number>& someActionCosts);
+};
+
+#endif	// _SPHG_PLANNER_HMAX_H
+// ================================================================================================ End of file "HMax.h"
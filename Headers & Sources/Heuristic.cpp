@@ -0,0 +1,73 @@
+// ================================================================================================ Beginning of file "Heuristic.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//				   Heuristic/2 --- Build the delete relaxation of the grounded actions of a problem
+//					  SizeOf/0 --- Memory size of the delete relaxation
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <limits>						// Visibility for std::numeric_limits
+
+// Project files
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+	#include "Heuristic.h"				// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const PDDL::Number Heuristic::DEAD_END = std::numeric_limits<PDDL::Number>::infinity();
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Heuristic::Heuristic/2
+//
+Heuristic::Heuristic(const GroundedActions& someGroundedActions, const State& aGoal) :
+	theRelaxedActions(someGroundedActions.size()),
+	thePreconditionOf(State::end()) {
+
+	for (GroundedAction::HAction a = 0; a < someGroundedActions.size(); ++a)
+	{
+		const GroundedAction& anAction = someGroundedActions[a];
+		RelaxedAction& aRelaxedAction = theRelaxedActions[a];
+
+		const State& P = anAction.GetthePreconditions();
+		for (State::index_type i = P.first(); i < State::end(); i = P.next(i))
+		{
+			aRelaxedAction.thePreconditions.push_back((PDDL::HPredicate) i);
+			thePreconditionOf[i].push_back(a);
+		}
+		if (aRelaxedAction.thePreconditions.empty())
+			theActionsWithoutPreconditions.push_back(a);
+
+		const State& A = anAction.GettheAdditions();
+		for (State::index_type i = A.first(); i < State::end(); i = A.next(i))
+			aRelaxedAction.theAdditions.push_back((PDDL::HPredicate) i);
+
+		aRelaxedAction.theCost = 1 + anAction.GettheCost();
+	}
+
+	for (State::index_type i = aGoal.first(); i < State::end(); i = aGoal.next(i))
+		theGoal.push_back((PDDL::HPredicate) i);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Heuristic::SizeOf/0
+//
+size_t Heuristic::SizeOf() const {
+	size_t s = sizeof(*this)
+			 + theRelaxedActions.capacity() * sizeof(RelaxedAction)
+			 + thePreconditionOf.capacity() * sizeof(std::vector<GroundedAction::HAction>)
+			 + theActionsWithoutPreconditions.capacity() * sizeof(GroundedAction::HAction)
+			 + theGoal.capacity() * sizeof(PDDL::HPredicate)
+			 + thePreferredActions.capacity() * sizeof(GroundedAction::HAction);
+
+	for (std::vector<RelaxedAction>::size_type a = 0; a < theRelaxedActions.size(); ++a)
+		s += (theRelaxedActions[a].thePreconditions.capacity() + theRelaxedActions[a].theAdditions.capacity()) * sizeof(PDDL::HPredicate);
+	for (std::vector< std::vector<GroundedAction::HAction> >::size_type p = 0; p < thePreconditionOf.size(); ++p)
+		s += thePreconditionOf[p].capacity() * sizeof(GroundedAction::HAction);
+
+	return s;
+}
+
+// ================================================================================================ End of file "Heuristic.cpp"
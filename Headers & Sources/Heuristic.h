@@ -0,0 +1,78 @@
+// ================================================================================================ Beginning of file "Heuristic.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+#define _SPHG_PLANNER_HEURISTIC_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the relaxed actions and the goal predicates
+
+// Project files
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Number and PDDL::HPredicate
+#endif
+
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+	#include "GroundedAction.h"			// Visibility for GroundedAction and GroundedActions
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// An estimate of the cost of the cheapest plan from a State to the goal of a problem. The estimate is
+// computed on the delete relaxation of the grounded actions: deletions and negative preconditions are
+// ignored, and an action costs 1 plus its (:action-costs) numeric cost, as in BestFirst/0.
+//
+class Heuristic {
+	// ----- Types
+	public:
+		static const PDDL::Number DEAD_END;							// No plan reaches the goal from the evaluated State
+
+	protected:
+		struct RelaxedAction {
+			std::vector<PDDL::HPredicate>		thePreconditions;	// The (positive) preconditions of the grounded action
+			std::vector<PDDL::HPredicate>		theAdditions;		// The additions of the grounded action
+			PDDL::Number						theCost;			// 1 + the numeric cost of the grounded action
+		};
+
+
+	// ----- Properties
+	protected:
+		std::vector<RelaxedAction>							theRelaxedActions;					// One relaxed action per grounded action, at the same position
+		std::vector< std::vector<GroundedAction::HAction> >	thePreconditionOf;					// For each predicate, the relaxed actions requiring it
+		std::vector<GroundedAction::HAction>				theActionsWithoutPreconditions;		// The relaxed actions applicable to any State
+		std::vector<PDDL::HPredicate>						theGoal;							// The predicates of the goal
+		std::vector<GroundedAction::HAction>				thePreferredActions;				// The preferred actions of the last evaluated State, in increasing order; empty when not computed
+
+
+	// ----- Constructors
+	public:
+		Heuristic(const GroundedActions& someGroundedActions, const State& aGoal);
+
+
+	// ----- Destructor
+	public:
+		virtual ~Heuristic() {}
+
+
+	// ----- Accessors
+	public:
+		inline const std::vector<GroundedAction::HAction>& GetthePreferredActions() const { return thePreferredActions; }
+
+
+	// ----- Operations
+	public:
+		virtual PDDL::Number Evaluate(const State& aState) = 0;	// The estimate for aState; DEAD_END when the goal is not reachable from aState
+		virtual size_t SizeOf() const;
+};
+
+#endif	// _SPHG_PLANNER_HEURISTIC_H
+// ================================================================================================ End of file "Heuristic.h"
@@ -0,0 +1,176 @@
+// ================================================================================================ Beginning of file "LMCut.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//					   LMCut/2 --- Index the relaxed actions by the predicates they add
+//					 MakeCut/1 --- Goal zone, reached predicates and cut from the h_max supporters
+//					Evaluate/1 --- Sum the costs of successive cuts until the goal costs nothing
+//					  SizeOf/0 --- Memory size of the heuristic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+#ifndef _SPHG_PLANNER_LMCUT_H
+	#include "LMCut.h"					// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// LMCut::LMCut/2
+//
+LMCut::LMCut(const GroundedActions& someGroundedActions, const State& aGoal) :
+	HMax(someGroundedActions, aGoal),
+	theAchievers(State::end()),
+	theRemainingCosts(theRelaxedActions.size()),
+	theGoalZone(State::end()),
+	theReached(State::end()),
+	theActionIsInCut(theRelaxedActions.size()) {
+
+	for (GroundedAction::HAction a = 0; a < theRelaxedActions.size(); ++a)
+		for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+			theAchievers[theRelaxedActions[a].theAdditions[q]].push_back(a);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// LMCut::MakeCut/1
+//
+void LMCut::MakeCut(const State& aState) {
+	// 1. The goal zone starts with the most expensive predicate of theGoal...
+	PDDL::HPredicate g = theGoal[0];
+	for (std::vector<PDDL::HPredicate>::size_type n = 1; n < theGoal.size(); ++n)
+		if (thePredicateCosts[g] < thePredicateCosts[theGoal[n]])
+			g = theGoal[n];
+
+	theGoalZone.assign(State::end(), false);
+	theGoalZone[g] = true;
+	theStack.push_back(g);
+	// ... and grows backward with the supporters of the zero cost actions adding a predicate of the goal zone
+	while (! theStack.empty())
+	{
+		const PDDL::HPredicate p = theStack.back();
+		theStack.pop_back();
+
+		for (std::vector<GroundedAction::HAction>::size_type n = 0; n < theAchievers[p].size(); ++n)
+		{
+			const GroundedAction::HAction a = theAchievers[p][n];
+			const State::index_type s = theSupporters[a];
+			if ((theRemainingCosts[a] <= 0.0f) && (State::end() != s) && !theGoalZone[s])
+			{
+				theGoalZone[s] = true;
+				theStack.push_back((PDDL::HPredicate) s);
+			}
+		}
+	}
+
+	// 2. Walk forward from aState with the supporters: the actions adding a predicate of the goal zone make the cut
+	theReached.assign(State::end(), false);
+	theCut.clear();
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+	{
+		theReached[i] = true;
+		theStack.push_back((PDDL::HPredicate) i);
+	}
+	for (std::vector<GroundedAction::HAction>::size_type n = 0; n < theActionsWithoutPreconditions.size(); ++n)
+	{
+		const GroundedAction::HAction a = theActionsWithoutPreconditions[n];
+		for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+		{
+			const PDDL::HPredicate p = theRelaxedActions[a].theAdditions[q];
+			if (theGoalZone[p])
+			{
+				if (! theActionIsInCut[a])
+				{
+					theActionIsInCut[a] = true;
+					theCut.push_back(a);
+				}
+			}
+			else if (! theReached[p])
+			{
+				theReached[p] = true;
+				theStack.push_back(p);
+			}
+		}
+	}
+	while (! theStack.empty())
+	{
+		const PDDL::HPredicate p = theStack.back();
+		theStack.pop_back();
+
+		for (std::vector<GroundedAction::HAction>::size_type n = 0; n < thePreconditionOf[p].size(); ++n)
+		{
+			const GroundedAction::HAction a = thePreconditionOf[p][n];
+			if (p != theSupporters[a])
+				continue;
+
+			for (std::vector<PDDL::HPredicate>::size_type q = 0; q < theRelaxedActions[a].theAdditions.size(); ++q)
+			{
+				const PDDL::HPredicate r = theRelaxedActions[a].theAdditions[q];
+				if (theGoalZone[r])
+				{
+					if (! theActionIsInCut[a])
+					{
+						theActionIsInCut[a] = true;
+						theCut.push_back(a);
+					}
+				}
+				else if (! theReached[r])
+				{
+					theReached[r] = true;
+					theStack.push_back(r);
+				}
+			}
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// LMCut::Evaluate/1
+//
+PDDL::Number LMCut::Evaluate(const State& aState) {
+	for (std::vector<RelaxedAction>::size_type a = 0; a < theRelaxedActions.size(); ++a)
+		theRemainingCosts[a] = theRelaxedActions[a].theCost;
+
+	PDDL::Number aGoalCost = HMax::Explore(aState, theRemainingCosts);
+	if (DEAD_END == aGoalCost)
+		return DEAD_END;
+
+	PDDL::Number h = 0.0f;
+	while (0.0f < aGoalCost)
+	{
+		LMCut::MakeCut(aState);
+		if (theCut.empty())		// No action leads into theGoalZone (e.g. float rounding of the costs): keep the landmarks found so far
+			break;
+
+		// The cheapest action of the cut is the cost of this landmark
+		PDDL::Number m = theRemainingCosts[theCut[0]];
+		for (std::vector<GroundedAction::HAction>::size_type n = 1; n < theCut.size(); ++n)
+			if (theRemainingCosts[theCut[n]] < m)
+				m = theRemainingCosts[theCut[n]];
+
+		h += m;
+		for (std::vector<GroundedAction::HAction>::size_type n = 0; n < theCut.size(); ++n)
+		{
+			theRemainingCosts[theCut[n]] -= m;
+			theActionIsInCut[theCut[n]] = false;
+		}
+
+		aGoalCost = HMax::Explore(aState, theRemainingCosts);
+	}
+
+	return h;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// LMCut::SizeOf/0
+//
+size_t LMCut::SizeOf() const {
+	size_t s = HMax::SizeOf() - sizeof(HMax) + sizeof(*this)
+			 + theAchievers.capacity() * sizeof(std::vector<GroundedAction::HAction>)
+			 + theRemainingCosts.capacity() * sizeof(PDDL::Number)
+			 + (theGoalZone.capacity() + theReached.capacity() + theActionIsInCut.capacity()) / 8
+			 + theCut.capacity() * sizeof(GroundedAction::HAction)
+			 + theStack.capacity() * sizeof(PDDL::HPredicate);
+
+	for (std::vector< std::vector<GroundedAction::HAction> >::size_type p = 0; p < theAchievers.size(); ++p)
+		s += theAchievers[p].capacity() * sizeof(GroundedAction::HAction);
+
+	return s;
+}
+
+// ================================================================================================ End of file "LMCut.cpp"
@@ -0,0 +1,53 @@
+// ================================================================================================ Beginning of file "LMCut.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_LMCUT_H
+#define _SPHG_PLANNER_LMCUT_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <vector>		// STL Store house for the achievers of the predicates, the goal zone and the cut
+
+// Project files
+#ifndef _SPHG_PLANNER_HMAX_H
+	#include "HMax.h"					// Visibility for HMax
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// The LM-cut heuristic (Helmert & Domshlak, 2009): as long as the h_max cost of the goal is positive,
+// find a cut of relaxed actions (a disjunctive action landmark) between the state and the goal with
+// the supporters of the h_max computation, add the cheapest cost of this cut to the estimate and
+// remove this cost from all the actions of the cut. LM-cut is admissible and dominates h_max.
+//
+class LMCut : public HMax {
+	// ----- Properties
+	private:
+		std::vector< std::vector<GroundedAction::HAction> >	theAchievers;			// For each predicate, the relaxed actions adding it
+		std::vector<PDDL::Number>							theRemainingCosts;		// The costs of the relaxed actions, decreased by each cut
+		std::vector<bool>									theGoalZone;			// The predicates reaching the goal through zero cost actions
+		std::vector<bool>									theReached;				// The predicates reached from the state without entering theGoalZone
+		std::vector<bool>									theActionIsInCut;		// The relaxed actions of theCut
+		std::vector<GroundedAction::HAction>				theCut;					// The relaxed actions leading from theReached predicates into theGoalZone
+		std::vector<PDDL::HPredicate>						theStack;				// The predicates yet to visit while building theGoalZone or theReached
+
+
+	// ----- Constructors
+	public:
+		LMCut(const GroundedActions& someGroundedActions, const State& aGoal);
+
+
+	// ----- Operations
+	public:
+		virtual PDDL::Number Evaluate(const State& aState);
+		virtual size_t SizeOf() const;
+
+	private:
+		void MakeCut(const State& aState);		// Compute theGoalZone, theReached and theCut from the supporters of the last h_max computation
+};
+
+#endif	// _SPHG_PLANNER_LMCUT_H
+// ================================================================================================ End of file "LMCut.h"
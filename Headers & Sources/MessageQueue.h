@@ -0,0 +1,54 @@
+// ================================================================================================ Beginning of file "MessageQueue.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_MESSAGE_QUEUE_H
+#define _SPHG_PLANNER_MESSAGE_QUEUE_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <atomic>		// Visibility for std::atomic
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// A lock-free queue with many producers and a single consumer: any thread may Push/1 a Message while
+// the owner of the queue takes all the pushed Messages at once with PopAll/0. The Messages are linked
+// through their theNext member; the queue owns them between Push/1 and PopAll/0 but never allocates.
+// PopAll/0 gives the Messages in no particular order.
+//
+template <typename Message>
+class MessageQueue {
+	// ----- Properties
+	private:
+		std::atomic<Message*>					theHead;			// The last Message pushed; 0 when the queue is empty
+
+
+	// ----- Constructors
+	public:
+		MessageQueue() : theHead(0) {}
+
+	private:
+		MessageQueue(const MessageQueue&);				// A queue shared between threads is never copied...
+		MessageQueue& operator=(const MessageQueue&);	// ... nor assigned
+
+
+	// ----- Accessors
+	public:
+		inline bool Empty() const { return (0 == theHead.load(std::memory_order_acquire)); }
+
+
+	// ----- Operations
+	public:
+		inline void Push(Message* aMessage) {
+			aMessage->theNext = theHead.load(std::memory_order_relaxed);
+			while (! theHead.compare_exchange_weak(aMessage->theNext, aMessage, std::memory_order_release, std::memory_order_relaxed))
+				;
+		}
+
+		inline Message* PopAll() { return theHead.exchange(0, std::memory_order_acquire); }	// The Messages follow each other through theNext, until 0
+};
+
+#endif	// _SPHG_PLANNER_MESSAGE_QUEUE_H
+// ================================================================================================ End of file "MessageQueue.h"
@@ -0,0 +1,183 @@
+// ================================================================================================ Beginning of file "MutexGroups.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//						 Build/2 --- Find the pairs of predicates reachable together, then the groups of mutex predicates
+//						  Pack/2 --- The values of the variables of a state, bits after bits, unless the state is not reachable
+//						Unpack/2 --- The state of the values of the variables
+//						 Clear/0 --- Forget the groups
+//						SizeOf/0 --- Memory size of the groups
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// Project files
+#ifndef _SPHG_PLANNER_MUTEX_GROUPS_H
+	#include "MutexGroups.h"				// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const MutexGroups::HVariable MutexGroups::NO_VARIABLE;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MutexGroups::Build/2
+//
+// h^2: an action is applicable when its preconditions are reached, two by two; a predicate it adds
+// is then reached with the others it adds, and with each predicate reached with all its preconditions
+// which it neither deletes nor forbids. The negative preconditions are otherwise ignored, which only
+// reaches more pairs. The fixpoint reaches (at least) all the pairs of the reachable states.
+//
+// The groups are then grown in the order of the predicates, which keeps together the predicates of
+// the same objects (cf. StateSpaceForwardChaining::InsertAsSharedPredicate/1).
+//
+void MutexGroups::Build(const GroundedActions& someGroundedActions, const State& anInitialState) {
+	MutexGroups::Clear();
+
+	std::vector<State> thePairs(State::end());		// thePairs[p] holds q when p and q may be reached together, and p when p is reached
+	for (State::index_type i = anInitialState.first(); i < State::end(); i = anInitialState.next(i))
+		thePairs[i] = anInitialState;
+	State someReachedPredicates(anInitialState);
+
+	bool aNewPairIsReached = true;
+	while (aNewPairIsReached)
+	{
+		aNewPairIsReached = false;
+		for (GroundedAction::HAction a = 0; a < someGroundedActions.size(); ++a)
+		{
+			const GroundedAction& anAction = someGroundedActions[a];
+			const State& somePreconditions = anAction.GetthePreconditions();
+
+			bool anActionIsApplicable = true;
+			for (State::index_type i = somePreconditions.first(); anActionIsApplicable && (i < State::end()); i = somePreconditions.next(i))
+				anActionIsApplicable = thePairs[i].includes(somePreconditions);
+			if (! anActionIsApplicable)
+				continue;
+
+			// The predicates which may stay with the additions of anAction
+			State someDeletions(anAction.GettheDeletions());
+			someDeletions.remove(anAction.GettheAdditions());
+			State someCompatiblePredicates;
+			for (State::index_type i = someReachedPredicates.first(); i < State::end(); i = someReachedPredicates.next(i))
+				if (thePairs[i].includes(somePreconditions))
+					someCompatiblePredicates.insert((PDDL::HPredicate) i);
+			someCompatiblePredicates.remove(someDeletions);
+			someCompatiblePredicates.remove(anAction.GettheNegativePreconditions());
+			someCompatiblePredicates.add(anAction.GettheAdditions());
+
+			for (State::index_type i = anAction.GettheAdditions().first(); i < State::end(); i = anAction.GettheAdditions().next(i))
+				if (! thePairs[i].includes(someCompatiblePredicates))
+				{
+					thePairs[i].add(someCompatiblePredicates);
+					someReachedPredicates.insert((PDDL::HPredicate) i);
+					aNewPairIsReached = true;
+				}
+			for (State::index_type i = someCompatiblePredicates.first(); i < State::end(); i = someCompatiblePredicates.next(i))
+				if (! thePairs[i].includes(anAction.GettheAdditions()))
+				{
+					thePairs[i].add(anAction.GettheAdditions());
+					aNewPairIsReached = true;
+				}
+		}
+	}
+
+	// Each reached predicate opens a group, unless it is in a group already, with the next predicates mutex with all of the group
+	theVariables.assign(State::end(), NO_VARIABLE);
+	theValues.assign(State::end(), 0);
+	for (State::index_type i = someReachedPredicates.first(); i < State::end(); i = someReachedPredicates.next(i))
+		if (NO_VARIABLE == theVariables[i])
+		{
+			const HVariable v = (HVariable) theGroups.size();
+			theGroups.push_back(std::vector<State::index_type>(1, i));
+			State someMutexPredicates(someReachedPredicates);
+			someMutexPredicates.remove(thePairs[i]);
+			theVariables[i] = v;
+			theValues[i] = 1;
+
+			for (State::index_type j = someMutexPredicates.next(i); j < State::end(); j = someMutexPredicates.next(j))
+				if (NO_VARIABLE == theVariables[j])
+				{
+					theGroups[v].push_back(j);
+					someMutexPredicates.remove(thePairs[j]);
+					theVariables[j] = v;
+					theValues[j] = (INTERNAL_TYPES::u32) theGroups[v].size();
+				}
+		}
+
+	// Each variable takes the values 0 to |group|, in the lowest bits of a Word left
+	theNumberOfWords = 0;
+	INTERNAL_TYPES::u32 aShift = 8 * sizeof(Word);
+	for (HVariable v = 0; v < theGroups.size(); ++v)
+	{
+		INTERNAL_TYPES::u32 someBits = 1;
+		while ((1u << someBits) <= theGroups[v].size())
+			++someBits;
+		if (aShift + someBits > 8 * sizeof(Word))
+		{
+			++theNumberOfWords;
+			aShift = 0;
+		}
+		theWords.push_back(theNumberOfWords - 1);
+		theShifts.push_back(aShift);
+		theBits.push_back(someBits);
+		aShift += someBits;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MutexGroups::Pack/2
+//
+// aState is not reachable, and may not be packed, when it holds a predicate which h^2 did not reach
+// or two predicates of the same group
+//
+bool MutexGroups::Pack(const State& aState, Word* aPackedState) const {
+	for (INTERNAL_TYPES::u32 w = 0; w < theNumberOfWords; ++w)
+		aPackedState[w] = 0;
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+	{
+		const HVariable v = theVariables[i];
+		if ((NO_VARIABLE == v) || (0 != ((aPackedState[theWords[v]] >> theShifts[v]) & ((((Word) 1) << theBits[v]) - 1))))
+			return false;
+		aPackedState[theWords[v]] |= ((Word) theValues[i]) << theShifts[v];
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MutexGroups::Unpack/2
+//
+void MutexGroups::Unpack(const Word* aPackedState, State& aState) const {
+	aState.clear();
+	for (HVariable v = 0; v < theGroups.size(); ++v)
+	{
+		const INTERNAL_TYPES::u32 aValue = (INTERNAL_TYPES::u32) ((aPackedState[theWords[v]] >> theShifts[v]) & ((((Word) 1) << theBits[v]) - 1));
+		if (0 != aValue)
+			aState.insert((PDDL::HPredicate) theGroups[v][aValue - 1]);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MutexGroups::Clear/0
+//
+void MutexGroups::Clear() {
+	theGroups.clear();
+	theVariables.clear();
+	theValues.clear();
+	theWords.clear();
+	theShifts.clear();
+	theBits.clear();
+	theNumberOfWords = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MutexGroups::SizeOf/0
+//
+size_t MutexGroups::SizeOf() const {
+	size_t s = sizeof(*this)
+			 + theGroups.capacity() * sizeof(std::vector<State::index_type>)
+			 + theVariables.capacity() * sizeof(HVariable)
+			 + (theValues.capacity() + theWords.capacity() + theShifts.capacity() + theBits.capacity()) * sizeof(INTERNAL_TYPES::u32);
+	for (std::vector<std::vector<State::index_type> >::size_type v = 0; v < theGroups.size(); ++v)
+		s += theGroups[v].capacity() * sizeof(State::index_type);
+
+	return s;
+}
+
+// ================================================================================================ End of file "MutexGroups.cpp"
@@ -0,0 +1,92 @@
+// ================================================================================================ Beginning of file "MutexGroups.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_MUTEX_GROUPS_H
+#define _SPHG_PLANNER_MUTEX_GROUPS_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the groups, the variables and the values of the predicates
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32 and u64
+#endif
+
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+	#include "GroundedAction.h"			// Visibility for GroundedActions
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// Mutex groups: two predicates are mutex when no state reachable from theInitialState holds both of
+// them (e.g. a package at two places, or at a place and in a truck). The pairs of predicates which
+// may be reached together are over-approximated with h^2 on the grounded actions; each other pair is
+// a mutex. The reachable predicates are then partitioned, greedily, into groups of pairwise mutex
+// predicates: a reachable state holds at most one predicate of each group.
+//
+// Each group is a finite-domain variable whose values are its predicates, plus 0 when the state holds
+// none of them: the variable is packed in ceil(log2(|group| + 1)) bits of a Word, and a reachable
+// state in GettheNumberOfWords() Words, which is usually far less than a State (cf. StateRegistry).
+// A state which is not reachable from theInitialState of Build/2 may not be packed: Pack/2 then fails.
+//
+// Once built, nothing is written: several threads may share this object.
+//
+class MutexGroups {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32		HVariable;			// A position in theGroups
+		typedef		INTERNAL_TYPES::u64		Word;				// The variables of a packed state, from the low bits up
+
+		static const HVariable NO_VARIABLE = 0xFFFFFFFF;		// The variable of a predicate which is not reachable
+
+
+	// ----- Properties
+	private:
+		std::vector<std::vector<State::index_type> >	theGroups;		// The predicates of each group: value v > 0 of a variable is its predicate v - 1
+		std::vector<HVariable>							theVariables;	// The variable of each predicate...
+		std::vector<INTERNAL_TYPES::u32>				theValues;		// ... and its value in this variable
+		std::vector<INTERNAL_TYPES::u32>				theWords;		// The Word of each variable...
+		std::vector<INTERNAL_TYPES::u32>				theShifts;		// ... the position of its lowest bit in this Word...
+		std::vector<INTERNAL_TYPES::u32>				theBits;		// ... and its number of bits; a variable never overlaps two Words
+		INTERNAL_TYPES::u32								theNumberOfWords;
+
+
+	// ----- Constructors
+	public:
+		MutexGroups() { MutexGroups::Clear(); }
+
+
+	// ----- Accessors
+	public:
+		inline bool Empty() const { return theGroups.empty(); }
+		inline HVariable GettheNumberOfVariables() const { return (HVariable) theGroups.size(); }
+		inline const std::vector<State::index_type>& GettheGroup(HVariable v) const { return theGroups[v]; }
+		inline HVariable GettheVariable(State::index_type aPredicate) const { return theVariables[aPredicate]; }
+		inline INTERNAL_TYPES::u32 GettheValue(State::index_type aPredicate) const { return theValues[aPredicate]; }
+		inline INTERNAL_TYPES::u32 GettheNumberOfWords() const { return theNumberOfWords; }
+		inline bool IsCompact() const { return (!theGroups.empty() && (theNumberOfWords < State::slots())); }	// Is a packed state smaller than a State?
+
+
+	// ----- Operations
+	public:
+		// Find the mutex groups of the predicates reachable from anInitialState with someGroundedActions
+		void Build(const GroundedActions& someGroundedActions, const State& anInitialState);
+
+		bool Pack(const State& aState, Word* aPackedState) const;		// aPackedState has GettheNumberOfWords() Words; false when aState is not reachable
+		void Unpack(const Word* aPackedState, State& aState) const;
+
+		void Clear();
+		size_t SizeOf() const;
+};
+
+#endif	// _SPHG_PLANNER_MUTEX_GROUPS_H
+// ================================================================================================ End of file "MutexGroups.h"
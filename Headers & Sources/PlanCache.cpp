@@ -0,0 +1,312 @@
+// ================================================================================================ Beginning of file "PlanCache.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//				   PlanCache/2 --- An empty cache with its limits
+//						Size/0 --- Number of plans in the cache
+//				  GettheHits/0 --- Number of lookups which found a plan
+//				GettheMisses/0 --- Number of lookups which found no plan
+//			 GettheEvictions/0 --- Number of plans dropped to fit the limits of the cache
+//		  GettheProcessCache/0 --- The cache shared by all the threads of the process
+//						Hash/1 --- 64 bits hash value of a domain
+//				  MaketheKey/2 --- Hash value of a domain, then packed initial and goal states of a problem
+//						Find/4 --- Look for the plan of a problem
+//						Find/3 --- Same as Find/4 with the key of the problem
+//					  Insert/4 --- Store the plan of a problem
+//					  Insert/3 --- Same as Insert/4 with the key of the problem
+//					   Clear/0 --- Evict all the plans
+//					  SizeOf/0 --- Memory size of the cache
+//					   Evict/0 --- Drop the least recently used plans until the cache fits its limits
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::sort
+#include <vector>						// Visibility for std::vector
+
+// Project files
+#ifndef _SPHG_PLANNER_PLAN_CACHE_H
+	#include "PlanCache.h"					// Class visibility
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"						// Visibility for State and Convert/1
+#endif
+
+// The limits of the cache shared by all the threads of the process
+#define SPHG_PLAN_CACHE_ENTRIES			4096
+#define SPHG_PLAN_CACHE_BYTES			(16 * 1024 * 1024)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Local routines
+//
+namespace {
+	// FNV-1a, one byte after the other
+	inline void HashBytes(PlanCache::HashValue& h, const void* someBytes, size_t aSize) {
+		const unsigned char* b = (const unsigned char*) someBytes;
+		for (size_t i = 0; i < aSize; ++i)
+		{
+			h ^= b[i];
+			h *= 0x100000001b3ULL;
+		}
+	}
+
+	inline void HashIdentifier(PlanCache::HashValue& h, const PDDL::Identifier& anIdentifier) {
+		HashBytes(h, anIdentifier.c_str(), 1 + anIdentifier.size());	// The final '\0' separates two identifiers
+	}
+
+	// The name of anIdentifier; an identifier the Problem does not name is packed as "#" followed by its
+	// handle. The constants are only read: several threads make keys for the same Problem at once
+	std::string Name(const std::map<PDDL::HIdentifier, PDDL::Identifier>& someConstants, PDDL::HIdentifier anIdentifier) {
+		const std::map<PDDL::HIdentifier, PDDL::Identifier>::const_iterator c = someConstants.find(anIdentifier);
+
+		return (someConstants.end() == c) ? ("#" + std::to_string(anIdentifier)) : c->second;
+	}
+
+	// The predicates of aState as "(name constant ... constant)", in alphabetical order
+	void PackState(std::string& aKey, const State& aState, const std::vector<Predicate>& someDomainPredicates, const Problem& aProblem) {
+		const std::map<PDDL::HIdentifier, PDDL::Identifier>& theConstants = aProblem.GettheConstants();
+		const std::vector<Predicate>& theProblemPredicates = aProblem.GetthePredicates();
+
+		std::vector<std::string> somePredicates;
+		for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+		{
+			const Predicate& p = (i < someDomainPredicates.size()) ? someDomainPredicates[i] : theProblemPredicates[i - someDomainPredicates.size()];
+			std::string aPredicate = "(" + Name(theConstants, p.GettheIdentifier());
+			for (Predicate::HArity a = 0; a < p.GettheArity(); ++a)
+				aPredicate += " " + Name(theConstants, p.GettheParameter(a));
+			somePredicates.push_back(aPredicate + ")");
+		}
+		std::sort(somePredicates.begin(), somePredicates.end());
+
+		for (std::vector<std::string>::size_type n = 0; n < somePredicates.size(); ++n)
+			aKey += somePredicates[n];
+	}
+
+	size_t SizeOfthePlan(const EXTERNAL_TYPES::plan& aPlan) {
+		size_t s = aPlan.capacity() * sizeof(EXTERNAL_TYPES::op);
+		for (EXTERNAL_TYPES::plan::size_type o = 0; o < aPlan.size(); ++o)
+		{
+			s += aPlan[o].first.capacity() + aPlan[o].second.capacity() * sizeof(std::string);
+			for (EXTERNAL_TYPES::parameters::size_type a = 0; a < aPlan[o].second.size(); ++a)
+				s += aPlan[o].second[a].capacity();
+		}
+
+		return s;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::PlanCache/2
+//
+PlanCache::PlanCache(size_t aMaximumEntries, size_t aMaximumBytes) : theMaximumEntries(aMaximumEntries), theMaximumBytes(aMaximumBytes), theBytes(0), theHits(0), theMisses(0), theEvictions(0) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Size/0
+//
+size_t PlanCache::Size() const {
+	std::lock_guard<std::mutex> aLock(theMutex);
+	return theEntries.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::GettheHits/0
+//
+INTERNAL_TYPES::u64 PlanCache::GettheHits() const {
+	std::lock_guard<std::mutex> aLock(theMutex);
+	return theHits;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::GettheMisses/0
+//
+INTERNAL_TYPES::u64 PlanCache::GettheMisses() const {
+	std::lock_guard<std::mutex> aLock(theMutex);
+	return theMisses;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::GettheEvictions/0
+//
+INTERNAL_TYPES::u64 PlanCache::GettheEvictions() const {
+	std::lock_guard<std::mutex> aLock(theMutex);
+	return theEvictions;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::GettheProcessCache/0
+//
+// Built at the first call, by whichever thread makes it (the initialization of a local static is thread-safe)
+//
+PlanCache& PlanCache::GettheProcessCache() {
+	static PlanCache theProcessCache(SPHG_PLAN_CACHE_ENTRIES, SPHG_PLAN_CACHE_BYTES);
+	return theProcessCache;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Hash/1
+//
+// Two domains read from the same PDDL Domain file have the same hash value: the identifiers are
+// hashed in alphabetical order, and the operators and predicates in the order they were declared.
+//
+PlanCache::HashValue PlanCache::Hash(Domain& aDomain) {
+	HashValue h = 0xcbf29ce484222325ULL;
+
+	HashIdentifier(h, aDomain.GettheName());
+	for (std::map<PDDL::Identifier, PDDL::HIdentifier>::const_iterator i = aDomain.GettheConstants().begin(); i != aDomain.GettheConstants().end(); ++i)
+	{
+		HashIdentifier(h, i->first);
+		HashBytes(h, &i->second, sizeof(i->second));
+	}
+
+	const std::vector<Predicate>& thePredicates = aDomain.GetthePredicates();
+	for (std::vector<Predicate>::size_type p = 0; p < thePredicates.size(); ++p)
+	{
+		const PDDL::HIdentifier anIdentifier = thePredicates[p].GettheIdentifier();
+		const Predicate::HArity anArity = thePredicates[p].GettheArity();
+		HashBytes(h, &anIdentifier, sizeof(anIdentifier));
+		HashBytes(h, &anArity, sizeof(anArity));
+		for (Predicate::HArity a = 0; a < anArity; ++a)
+		{
+			const PDDL::HIdentifier aParameter = thePredicates[p].GettheParameter(a);
+			HashBytes(h, &aParameter, sizeof(aParameter));
+		}
+	}
+
+	for (Domain::HOperator o = 0; o < aDomain.GettheNumberOfOperators(); ++o)
+	{
+		const Operator* Op = aDomain.GettheOperator(o);
+		const PDDL::HIdentifier anIdentifier = Op->GettheIdentifier();
+		HashBytes(h, &anIdentifier, sizeof(anIdentifier));
+
+		const Operator::HArity anArity = Op->GettheNumberOfParameters();
+		HashBytes(h, &anArity, sizeof(anArity));
+		for (Operator::HArity a = 0; a < anArity; ++a)
+		{
+			const PDDL::SORT aSort = Op->GettheSORTOfParameter(a);
+			const PDDL::HIdentifier aParameter = Op->GettheIdentifierOfParameter(a);
+			HashBytes(h, &aSort, sizeof(aSort));
+			HashBytes(h, &aParameter, sizeof(aParameter));
+		}
+
+		// The predicates of the operator, cut into preconditions, deletions, additions, ... by these positions
+		const Operator::HPredicate somePositions[6] = {Op->GetthePositionOfDeletedPreconditions(), Op->GetthePositionOfDeletions(), Op->GetthePositionOfAdditions(),
+													   Op->GetthePositionOfNegativePreconditions(), Op->GetthePositionOfAddedPreconditions(), Op->GettheNumberOfPredicates()};
+		HashBytes(h, somePositions, sizeof(somePositions));
+		for (Operator::HPredicate a = 0; a < Op->GettheNumberOfPredicates(); ++a)
+		{
+			const PDDL::HPredicate aPredicate = Op->GetthePredicate(a);
+			HashBytes(h, &aPredicate, sizeof(aPredicate));
+		}
+
+		const PDDL::Number aCost = aDomain.GetNumericCost(o);
+		HashBytes(h, &aCost, sizeof(aCost));
+	}
+
+	return h;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::MaketheKey/2
+//
+// The predicates are packed by name, as their numbers depend on the order in which the PDDL Problem
+// declares them; the initial and goal states are separated by '|', which no identifier contains.
+//
+std::string PlanCache::MaketheKey(Domain& aDomain, Domain::HProblem aProblem) {
+	const HashValue h = PlanCache::Hash(aDomain);
+	std::string aKey(sizeof(h), '\0');
+	for (size_t b = 0; b < sizeof(h); ++b)
+		aKey[b] = (char) (h >> (8 * b));
+
+	Problem& aPDDLProblem = *aDomain.GettheProblem(aProblem);
+	PackState(aKey, Convert(aPDDLProblem.GetthePositiveInitialState()), aDomain.GetthePredicates(), aPDDLProblem);
+	aKey += "|";
+	PackState(aKey, Convert(aPDDLProblem.GetthePositiveGoalState()), aDomain.GetthePredicates(), aPDDLProblem);
+
+	return aKey;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Find/4
+//
+bool PlanCache::Find(Domain& aDomain, Domain::HProblem aProblem, EXTERNAL_TYPES::plan& aPlan, PDDL::Number& aCost) {
+	return PlanCache::Find(PlanCache::MaketheKey(aDomain, aProblem), aPlan, aCost);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Find/3
+//
+bool PlanCache::Find(const std::string& aKey, EXTERNAL_TYPES::plan& aPlan, PDDL::Number& aCost) {
+	std::lock_guard<std::mutex> aLock(theMutex);
+
+	std::map<std::string, std::list<Entry>::iterator>::iterator i = theIndex.find(aKey);
+	if (theIndex.end() == i)
+	{
+		++theMisses;
+		return false;
+	}
+
+	// The entry found becomes the most recently used
+	theEntries.splice(theEntries.begin(), theEntries, i->second);
+	aPlan = i->second->thePlan;
+	aCost = i->second->theCost;
+	++theHits;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Insert/4
+//
+void PlanCache::Insert(Domain& aDomain, Domain::HProblem aProblem, const EXTERNAL_TYPES::plan& aPlan, PDDL::Number aCost) {
+	PlanCache::Insert(PlanCache::MaketheKey(aDomain, aProblem), aPlan, aCost);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Insert/3
+//
+// A plan already stored for aKey is replaced by aPlan.
+//
+void PlanCache::Insert(const std::string& aKey, const EXTERNAL_TYPES::plan& aPlan, PDDL::Number aCost) {
+	std::lock_guard<std::mutex> aLock(theMutex);
+
+	std::map<std::string, std::list<Entry>::iterator>::iterator i = theIndex.find(aKey);
+	if (theIndex.end() != i)
+	{
+		theBytes -= i->second->theSize;
+		theEntries.erase(i->second);
+		theIndex.erase(i);
+	}
+
+	Entry anEntry;
+	anEntry.theKey = aKey;
+	anEntry.thePlan = aPlan;
+	anEntry.theCost = aCost;
+	anEntry.theSize = sizeof(Entry) + 2 * anEntry.theKey.capacity() + SizeOfthePlan(anEntry.thePlan);	// theKey is also copied into theIndex
+	theEntries.push_front(anEntry);
+	theIndex[aKey] = theEntries.begin();
+	theBytes += anEntry.theSize;
+
+	PlanCache::Evict();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Clear/0
+//
+void PlanCache::Clear() {
+	std::lock_guard<std::mutex> aLock(theMutex);
+
+	theEvictions += theEntries.size();
+	theEntries.clear();
+	theIndex.clear();
+	theBytes = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::SizeOf/0
+//
+size_t PlanCache::SizeOf() const {
+	std::lock_guard<std::mutex> aLock(theMutex);
+	return (sizeof(*this) + theBytes);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// PlanCache::Evict/0
+//
+void PlanCache::Evict() {
+	while (!theEntries.empty() && ((theMaximumEntries < theEntries.size()) || (theMaximumBytes < theBytes)))
+	{
+		theBytes -= theEntries.back().theSize;
+		theIndex.erase(theEntries.back().theKey);
+		theEntries.pop_back();
+		++theEvictions;
+	}
+}
+
+// ================================================================================================ End of file "PlanCache.cpp"
@@ -0,0 +1,117 @@
+// ================================================================================================ Beginning of file "PlanCache.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_PLAN_CACHE_H
+#define _SPHG_PLANNER_PLAN_CACHE_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <list>			// STL Store house for the entries of the cache, from the most to the least recently used
+#include <map>			// STL Index of the entries by their keys
+#include <mutex>		// Visibility for std::mutex
+#include <stddef.h>		// Visibility for size_t
+#include <string>		// Visibility for std::string
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u64
+#endif
+
+#ifndef _EXTERNAL_TYPES_H
+	#include "ExternalTypes.h"			// Visibility for EXTERNAL_TYPES::plan
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"					// Visibility for Domain and Domain::HProblem
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Number
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// The plans found for a PDDL Domain, from the initial state of a Problem to its goal: looking up a
+// plan only reads the Domain and the Problem, so that a hit needs no StateSpaceForwardChaining. The key
+// is the hash value of the Domain (cf. Hash/1) followed by the predicates of the positive initial
+// and goal states, packed by name in alphabetical order: two PDDL problems declaring the same
+// predicates in different orders share their plans. A plan is stored with the identifiers of its
+// actions and their parameters (cf. StateSpaceForwardChaining::ConvertthePlanFound/1), which are
+// valid for any problem of the Domain. The least recently used plans are evicted when there are
+// more than theMaximumEntries plans or more than theMaximumBytes bytes in the cache.
+//
+// The cache is searched and filled by several threads at once: GettheProcessCache/0 is shared by all
+// the threads of the process. It serves the applications which solve many problems in one process
+// (cf. BatchPlanner::SetPlanCache/1); the command line solves one problem only and does not use it.
+//
+class PlanCache {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u64			HashValue;			// 64 bits hash value of a Domain
+
+	private:
+		struct Entry {
+			std::string							theKey;				// cf. MaketheKey/2
+			EXTERNAL_TYPES::plan				thePlan;
+			PDDL::Number						theCost;
+			size_t								theSize;			// The bytes of theKey and thePlan, counted against theMaximumBytes
+		};
+
+
+	// ----- Properties
+	private:
+		std::list<Entry>						theEntries;			// From the most recently used to the least recently used
+		std::map<std::string, std::list<Entry>::iterator>	theIndex;	// The entries by their keys
+		size_t									theMaximumEntries;
+		size_t									theMaximumBytes;
+		size_t									theBytes;			// The sum of the sizes of theEntries
+		INTERNAL_TYPES::u64						theHits;
+		INTERNAL_TYPES::u64						theMisses;
+		INTERNAL_TYPES::u64						theEvictions;
+		mutable std::mutex						theMutex;			// Only one thread at once reads or writes the cache
+
+
+	// ----- Constructors
+	public:
+		PlanCache(size_t aMaximumEntries, size_t aMaximumBytes);
+
+	private:
+		PlanCache(const PlanCache&);				// The cache is never copied...
+		PlanCache& operator=(const PlanCache&);		// ... but shared
+
+
+	// ----- Accessors
+	public:
+		size_t Size() const;
+		INTERNAL_TYPES::u64 GettheHits() const;
+		INTERNAL_TYPES::u64 GettheMisses() const;
+		INTERNAL_TYPES::u64 GettheEvictions() const;
+
+
+	// ----- Operations
+	public:
+		static PlanCache& GettheProcessCache();		// The cache shared by all the threads of the process
+
+		static HashValue Hash(Domain& aDomain);		// Hash value of the identifiers, predicates, operators and costs of aDomain
+
+		static std::string MaketheKey(Domain& aDomain, Domain::HProblem aProblem);	// The hash value of aDomain followed by the packed initial and goal states of aProblem
+
+		bool Find(Domain& aDomain, Domain::HProblem aProblem, EXTERNAL_TYPES::plan& aPlan, PDDL::Number& aCost);	// A hit copies the plan into aPlan and its cost into aCost
+		bool Find(const std::string& aKey, EXTERNAL_TYPES::plan& aPlan, PDDL::Number& aCost);						// Same as Find/4, when aKey = MaketheKey(aDomain, aProblem) is already known
+
+		void Insert(Domain& aDomain, Domain::HProblem aProblem, const EXTERNAL_TYPES::plan& aPlan, PDDL::Number aCost);	// Store a plan found for aProblem, then evict the least recently used plans
+		void Insert(const std::string& aKey, const EXTERNAL_TYPES::plan& aPlan, PDDL::Number aCost);						// Same as Insert/4, when aKey = MaketheKey(aDomain, aProblem) is already known
+
+		void Clear();	// Evict all the plans; the counters are not reset
+
+		size_t SizeOf() const;
+
+	private:
+		void Evict();	// Drop the least recently used entries until the cache fits its limits; theMutex is locked by the caller
+};
+
+#endif	// _SPHG_PLANNER_PLAN_CACHE_H
+// ================================================================================================ End of file "PlanCache.h"
@@ -0,0 +1,127 @@
+// ================================================================================================ Beginning of file "Portfolio.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//				   Portfolio/2 --- An empty portfolio for a problem
+//				  ~Portfolio/0 --- Frees the search structures of the engines
+//				 IsAvailable/1 --- Can a search take part in a portfolio?
+//						 Add/1 --- Build the search structures of a new engine
+//				   RunEngine/1 --- Ground when needed, search, and cancel the other engines when a plan is found
+//						 Run/0 --- Run all the engines at once, on separate threads, until the first plan
+//					  SizeOf/0 --- Memory size of the portfolio
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <thread>						// Visibility for std::thread
+
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"		// Visibility for MEMORY_ALLOCATION, STL, HPHA, CLASSIC
+#endif
+
+#ifndef _SPHG_PLANNER_PORTFOLIO_H
+	#include "Portfolio.h"					// Class visibility
+#endif
+
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+	#include "RunSearch.h"					// Visibility for NeedstheGroundedOperators/1 and RunSearch/3
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const Portfolio::HEngine Portfolio::NO_ENGINE;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::Portfolio/2
+//
+Portfolio::Portfolio(Domain& aDomain, Domain::HProblem aProblem) : theDomain(&aDomain), theProblem(aProblem), theCancellation(false), theWinner(NO_ENGINE) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::~Portfolio/0
+//
+Portfolio::~Portfolio() {
+	for (std::vector<Engine>::size_type e = 0; e < theEngines.size(); ++e)
+		delete theEngines[e].theSSFC;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::IsAvailable/1
+//
+bool Portfolio::IsAvailable(const PDDL::Identifier& aSearch) {
+	return (("breadth" == aSearch) || ("best" == aSearch) || ("astar-hmax" == aSearch) || ("astar-lmcut" == aSearch) || ("gbfs-ff" == aSearch)
+			|| ("iddfs" == aSearch) || ("idastar-hmax" == aSearch) || ("idastar-lmcut" == aSearch) || ("bidirectional" == aSearch));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::Add/1
+//
+// The search structures are built here, by the thread of the caller, as a StateSpaceForwardChaining
+// registers itself with the PDDL Problem it searches.
+//
+bool Portfolio::Add(const PDDL::Identifier& aSearch) {
+	if (! Portfolio::IsAvailable(aSearch))
+		return false;
+
+	Engine anEngine;
+	anEngine.theSearch = aSearch;
+	anEngine.theSSFC = new StateSpaceForwardChaining(*theDomain, theProblem);
+	anEngine.theSSFC->SetCancellation(&theCancellation);
+	theEngines.push_back(anEngine);
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::RunEngine/1
+//
+void Portfolio::RunEngine(HEngine anEngine) {
+	const PDDL::Identifier& aSearch = theEngines[anEngine].theSearch;
+	StateSpaceForwardChaining& s = *theEngines[anEngine].theSSFC;
+
+	if (NeedstheGroundedOperators(aSearch) && !s.Ground())
+		return;
+
+	const bool aSolutionWasFound = RunSearch(s, aSearch);
+
+	// A cancelled search reports no plan; among the engines which found a plan, only the first one wins
+	HEngine noEngine = NO_ENGINE;
+	if (aSolutionWasFound && theWinner.compare_exchange_strong(noEngine, anEngine))
+		theCancellation.store(true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::Run/0
+//
+bool Portfolio::Run() {
+	theCancellation.store(false);
+	theWinner.store(NO_ENGINE);
+
+#if (STL == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+	// This thread runs the first engine
+	std::vector<std::thread> theThreads;
+	for (HEngine e = 1; e < theEngines.size(); ++e)
+		theThreads.push_back(std::thread(&Portfolio::RunEngine, this, e));
+	if (! theEngines.empty())
+		Portfolio::RunEngine(0);
+	for (std::vector<std::thread>::size_type t = 0; t < theThreads.size(); ++t)
+		theThreads[t].join();
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION)
+	// These allocators are not thread-safe: run the engines one after the other, in the order they were added
+	for (HEngine e = 0; (e < theEngines.size()) && (NO_ENGINE == theWinner.load()); ++e)
+		Portfolio::RunEngine(e);
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+	return (NO_ENGINE != theWinner.load());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Portfolio::SizeOf/0
+//
+size_t Portfolio::SizeOf() {
+	size_t s = sizeof(*this) + theEngines.capacity() * sizeof(Engine);
+	for (std::vector<Engine>::size_type e = 0; e < theEngines.size(); ++e)
+		s += theEngines[e].theSearch.capacity() + theEngines[e].theSSFC->SizeOf();
+
+	return s;
+}
+
+// ================================================================================================ End of file "Portfolio.cpp"
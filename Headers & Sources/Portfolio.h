@@ -0,0 +1,99 @@
+// ================================================================================================ Beginning of file "Portfolio.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_PORTFOLIO_H
+#define _SPHG_PLANNER_PORTFOLIO_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <atomic>		// Visibility for std::atomic
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the engines of the portfolio
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"					// Visibility for Domain and Domain::HProblem
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Identifier
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"	// Visibility for StateSpaceForwardChaining
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// Several searches of the same problem, each with its own StateSpaceForwardChaining, run at once on
+// separate threads: the first search to find a plan wins and cancels all the others, which stop at
+// their next expansion. Each engine is named as with option -s of the console application; only the
+// searches which use a single thread may take part in a portfolio.
+//
+class Portfolio {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HEngine;			// At most 4294967296 engines in a portfolio
+		static const HEngine NO_ENGINE = 0xFFFFFFFF;				// No engine found a plan
+
+	private:
+		struct Engine {
+			PDDL::Identifier					theSearch;			// The name of the search, e.g. "gbfs-ff"
+			StateSpaceForwardChaining*			theSSFC;			// The search structures of this engine, owned by the portfolio
+		};
+
+
+	// ----- Properties
+	private:
+		Domain*									theDomain;			// The PDDL Domain...
+		Domain::HProblem						theProblem;			// ... and Problem all the engines search
+		std::vector<Engine>						theEngines;
+		std::atomic<bool>						theCancellation;	// Set by the winner to stop the other engines
+		std::atomic<HEngine>					theWinner;			// The first engine which found a plan; NO_ENGINE until then
+
+
+	// ----- Constructors
+	public:
+		Portfolio(Domain& aDomain, Domain::HProblem aProblem);
+
+	private:
+		Portfolio(const Portfolio&);				// The engines are owned by one portfolio only...
+		Portfolio& operator=(const Portfolio&);		// ... and never shared
+
+
+	// ----- Destructor
+	public:
+		~Portfolio();
+
+
+	// ----- Accessors
+	public:
+		inline HEngine Size() const { return (HEngine) theEngines.size(); }
+		inline HEngine GettheWinner() const { return theWinner.load(); }
+		inline const PDDL::Identifier& GettheSearch(HEngine anEngine) const { return theEngines[anEngine].theSearch; }
+		inline StateSpaceForwardChaining& GettheSSFC(HEngine anEngine) { return *theEngines[anEngine].theSSFC; }
+
+
+	// ----- Operations
+	public:
+		static bool IsAvailable(const PDDL::Identifier& aSearch);	// Can aSearch take part in a portfolio?
+
+		bool Add(const PDDL::Identifier& aSearch);	// Build the search structures of a new engine before Run/0; false when aSearch is not available
+
+		bool Run();				// Run all the engines until one of them finds a plan (true) or all of them fail (false)
+
+		size_t SizeOf();
+
+	private:
+		void RunEngine(HEngine anEngine);	// Ground the operators when the search needs them, then search; the first engine to find a plan cancels the others
+};
+
+#endif	// _SPHG_PLANNER_PORTFOLIO_H
+// ================================================================================================ End of file "Portfolio.h"
@@ -0,0 +1,134 @@
+// ================================================================================================ Beginning of file "RunSearch.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//	NeedstheGroundedOperators/1 --- Does a search need the grounded operators?
+//			  MaketheHeuristic/3 --- The heuristic a search is named with
+//					 RunSearch/3 --- Run the search of a name on a StateSpaceForwardChaining
+//				   StartSearch/3 --- Start the search of a name, to be stepped
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <thread>						// Visibility for std::thread::hardware_concurrency
+#include <vector>						// Visibility for std::vector
+
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"		// Visibility for MEMORY_ALLOCATION, STL, HPHA, CLASSIC
+#endif
+
+#ifndef _SPHG_PLANNER_FF_H
+	#include "FF.h"
+#endif
+
+#ifndef _SPHG_PLANNER_HMAX_H
+	#include "HMax.h"
+#endif
+
+#ifndef _SPHG_PLANNER_LMCUT_H
+	#include "LMCut.h"
+#endif
+
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+	#include "RunSearch.h"					// Prototypes visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// NeedstheGroundedOperators/1
+//
+// The heuristics are computed on the grounded operators, the bidirectional search regresses them and
+// the threads of the parallel searches share them.
+//
+bool NeedstheGroundedOperators(const PDDL::Identifier& aSearch) {
+	return ((0 == aSearch.compare(0, 5, "astar")) || (0 == aSearch.compare(0, 7, "idastar")) || (0 == aSearch.compare(0, 4, "gbfs")) || (0 == aSearch.compare(0, 3, "hda"))
+			|| ("bidirectional" == aSearch) || ("parallel-breadth" == aSearch));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MaketheHeuristic/3
+//
+// The heuristic is named by the end of the name of the search, e.g. "idastar-hmax" or "gbfs-ff".
+//
+Heuristic* MaketheHeuristic(const PDDL::Identifier& aSearch, const GroundedActions& someGroundedActions, const State& aGoal) {
+	const PDDL::Identifier::size_type aDash = aSearch.rfind('-');
+	if (PDDL::Identifier::npos == aDash)
+		return 0;
+
+	const PDDL::Identifier aHeuristic(aSearch, aDash + 1);
+	if ("hmax" == aHeuristic)
+		return new HMax(someGroundedActions, aGoal);
+	if ("lmcut" == aHeuristic)
+		return new LMCut(someGroundedActions, aGoal);
+	if ("ff" == aHeuristic)
+		return new FF(someGroundedActions, aGoal);
+
+	return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// RunSearch/3
+//
+// someThreads is used by the parallel-breadth and hash distributed searches only (0: as many as the
+// hardware runs concurrently); the searches which need the grounded operators return false when
+// Ground/0 did not succeed.
+//
+bool RunSearch(StateSpaceForwardChaining& aSSFC, const PDDL::Identifier& aSearch, unsigned int someThreads) {
+	if ("breadth" == aSearch)
+		return aSSFC.BreadthFirst();
+	if ("best" == aSearch)
+		return aSSFC.BestFirst();
+	if ("iddfs" == aSearch)
+		return aSSFC.IterativeDeepening();
+	if ("bidirectional" == aSearch)
+		return aSSFC.Bidirectional();
+	if ("parallel-breadth" == aSearch)
+		return aSSFC.ParallelBreadthFirst(someThreads);
+
+	bool aSolutionWasFound = false;
+	if (0 == aSearch.compare(0, 3, "hda"))
+	{
+		// Each thread evaluates the states it owns with its own heuristic
+		std::vector<Heuristic*> someHeuristics((0 == someThreads) ? ((0 == std::thread::hardware_concurrency()) ? 1 : std::thread::hardware_concurrency()) : someThreads, 0);
+		for (std::vector<Heuristic*>::size_type h = 0; h < someHeuristics.size(); ++h)
+			someHeuristics[h] = MaketheHeuristic(aSearch, aSSFC.GettheGroundedActions(), aSSFC.GettheFinalState());
+		aSolutionWasFound = aSSFC.HashDistributedAStar(someHeuristics);
+		for (std::vector<Heuristic*>::size_type h = 0; h < someHeuristics.size(); ++h)
+			delete someHeuristics[h];
+
+		return aSolutionWasFound;
+	}
+
+	Heuristic* aHeuristic = MaketheHeuristic(aSearch, aSSFC.GettheGroundedActions(), aSSFC.GettheFinalState());
+	if (0 == aHeuristic)
+		return false;
+	if (0 == aSearch.compare(0, 6, "astar-"))
+		aSolutionWasFound = aSSFC.AStar(*aHeuristic);
+	else if (0 == aSearch.compare(0, 8, "idastar-"))
+		aSolutionWasFound = aSSFC.IterativeDeepening(aHeuristic);
+	else if (0 == aSearch.compare(0, 5, "gbfs-"))
+		aSolutionWasFound = aSSFC.GreedyBestFirst(*aHeuristic);
+	delete aHeuristic;
+
+	return aSolutionWasFound;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StartSearch/3
+//
+// Only the breadth, best, A* and greedy searches can be started, then stepped (cf. StateSpaceForwardChaining::Step/1).
+//
+bool StartSearch(StateSpaceForwardChaining& aSSFC, const PDDL::Identifier& aSearch, Heuristic* aHeuristic) {
+	if ("breadth" == aSearch)
+		return aSSFC.StartBreadthFirst();
+	if ("best" == aSearch)
+		return aSSFC.StartBestFirst();
+	if (0 == aHeuristic)
+		return false;
+	if (0 == aSearch.compare(0, 6, "astar-"))
+		return aSSFC.StartAStar(*aHeuristic);
+	if (0 == aSearch.compare(0, 5, "gbfs-"))
+		return aSSFC.StartGreedyBestFirst(*aHeuristic);
+
+	return false;
+}
+
+// ================================================================================================ End of file "RunSearch.cpp"
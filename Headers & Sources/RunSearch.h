@@ -0,0 +1,47 @@
+// ================================================================================================ Beginning of file "RunSearch.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+#define _SPHG_PLANNER_RUN_SEARCH_H
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler 
+#endif					// _MSC_VER
+
+// Project files
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+	#include "Heuristic.h"					// Visibility for Heuristic
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"						// Visibility for PDDL::Identifier
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"	// Visibility for StateSpaceForwardChaining
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//	NeedstheGroundedOperators/1 --- Does a search need the grounded operators?
+//			  MaketheHeuristic/3 --- The heuristic a search is named with
+//					 RunSearch/3 --- Run the search of a name on a StateSpaceForwardChaining
+//				   StartSearch/3 --- Start the search of a name, to be stepped
+//
+// The searches are named as with option -s of the console application, e.g. "astar-lmcut"; the
+// console application, Portfolio, BatchPlanner and Scheduler all run their searches with these.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+bool NeedstheGroundedOperators(const PDDL::Identifier& aSearch);	// The heuristic, bidirectional, parallel and hash distributed searches
+
+Heuristic* MaketheHeuristic(const PDDL::Identifier& aSearch, const GroundedActions& someGroundedActions, const State& aGoal);	// new HMax, LMCut or FF, owned by the caller; 0 when aSearch needs none
+
+bool RunSearch(StateSpaceForwardChaining& aSSFC, const PDDL::Identifier& aSearch, unsigned int someThreads = 0);	// false when aSearch is unknown, or needs the grounded operators of aSSFC which Ground/0 did not build
+
+bool StartSearch(StateSpaceForwardChaining& aSSFC, const PDDL::Identifier& aSearch, Heuristic* aHeuristic);	// aHeuristic is 0, or made by MaketheHeuristic/3 and lives until the search ends
+
+#endif					// _SPHG_PLANNER_RUN_SEARCH_H
+// ================================================================================================ End of file "RunSearch.h"
@@ -0,0 +1,230 @@
+// ================================================================================================ Beginning of file "Scheduler.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//				   Scheduler/3 --- An empty scheduler with the budget of a tick and the size of a slice
+//				  ~Scheduler/0 --- Frees the search structures and the heuristics of the queries
+//				 IsAvailable/1 --- Can a search be scheduled?
+//						 Add/3 --- Ground when needed and start the search of a new query
+//					   Serve/0 --- Expand slices of the next queries of the tick, until the tick ends
+//						Tick/1 --- Order the pending queries by priority plus age and serve them during a tick
+//					 Latency/1 --- Percentile of the latencies of the ended queries
+//					  SizeOf/0 --- Memory size of the scheduler
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::sort and std::stable_sort
+#include <thread>						// Visibility for std::thread
+
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"		// Visibility for MEMORY_ALLOCATION, STL, HPHA, CLASSIC
+#endif
+
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+	#include "RunSearch.h"					// Visibility for NeedstheGroundedOperators/1, MaketheHeuristic/3 and StartSearch/3
+#endif
+
+#ifndef _SPHG_PLANNER_SCHEDULER_H
+	#include "Scheduler.h"					// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const Scheduler::HQuery Scheduler::NO_QUERY;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::Scheduler/3
+//
+Scheduler::Scheduler(Domain& aDomain, INTERNAL_TYPES::u64 aTickBudget, INTERNAL_TYPES::u32 aSliceExpansions) :
+	theDomain(&aDomain),
+	theTickBudget(aTickBudget),
+	theSliceExpansions((0 == aSliceExpansions) ? 1 : aSliceExpansions),
+	theNextInOrder(0),
+	theTicks(0) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::~Scheduler/0
+//
+Scheduler::~Scheduler() {
+	for (std::vector<Query>::size_type q = 0; q < theQueries.size(); ++q)
+	{
+		delete theQueries[q].theHeuristic;
+		delete theQueries[q].theSSFC;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::IsAvailable/1
+//
+bool Scheduler::IsAvailable(const PDDL::Identifier& aSearch) {
+	return (("breadth" == aSearch) || ("best" == aSearch) || ("astar-hmax" == aSearch) || ("astar-lmcut" == aSearch) || ("gbfs-ff" == aSearch));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::Add/3
+//
+// As with Portfolio::Add/1, the search structures are built here, by the thread of the caller, as a
+// StateSpaceForwardChaining registers itself with the PDDL Problem it searches.
+//
+Scheduler::HQuery Scheduler::Add(Domain::HProblem aProblem, const PDDL::Identifier& aSearch, INTERNAL_TYPES::u32 aPriority) {
+	if (! Scheduler::IsAvailable(aSearch))
+		return NO_QUERY;
+
+	Query aQuery;
+	aQuery.theSearch = aSearch;
+	aQuery.theSSFC = new StateSpaceForwardChaining(*theDomain, aProblem);
+	aQuery.theHeuristic = 0;
+	aQuery.thePriority = (0 == aPriority) ? 1 : aPriority;
+	aQuery.theAge = 0;
+	aQuery.theQueryIsPending = true;
+	aQuery.thePlanIsFound = false;
+	aQuery.theSubmission = std::chrono::steady_clock::now();
+	aQuery.theLatency = 0;
+	StateSpaceForwardChaining& s = *aQuery.theSSFC;
+
+	if (NeedstheGroundedOperators(aSearch) && !s.Ground())
+	{
+		delete aQuery.theSSFC;
+		return NO_QUERY;
+	}
+
+	aQuery.theHeuristic = MaketheHeuristic(aSearch, s.GettheGroundedActions(), s.GettheFinalState());
+	aQuery.thePlanIsFound = StartSearch(s, aSearch, aQuery.theHeuristic);
+
+	// The initial state may already be a solution, or a dead end
+	if (StateSpaceForwardChaining::SEARCH_IN_PROGRESS != s.GettheStatus())
+	{
+		aQuery.theQueryIsPending = false;
+		aQuery.theLatency = (INTERNAL_TYPES::u64) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aQuery.theSubmission).count();
+		theLatencies.push_back(aQuery.theLatency);
+	}
+
+	theQueries.push_back(aQuery);
+
+	return (HQuery) (theQueries.size() - 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::Serve/0
+//
+// Each query of theOrder is taken by exactly one thread, so that its StateSpaceForwardChaining is
+// never stepped by two threads at once.
+//
+void Scheduler::Serve() {
+	for (std::vector<HQuery>::size_type o = theNextInOrder.fetch_add(1); (o < theOrder.size()) && (std::chrono::steady_clock::now() < theEndOftheTick); o = theNextInOrder.fetch_add(1))
+	{
+		Query& aQuery = theQueries[theOrder[o]];
+		StateSpaceForwardChaining& s = *aQuery.theSSFC;
+
+		aQuery.theAge = 0;
+		for (INTERNAL_TYPES::u32 n = 0; (n < aQuery.thePriority) && (StateSpaceForwardChaining::SEARCH_IN_PROGRESS == s.GettheStatus()) && (std::chrono::steady_clock::now() < theEndOftheTick); ++n)
+			if (s.Step(theSliceExpansions))
+				aQuery.thePlanIsFound = true;
+
+		if (StateSpaceForwardChaining::SEARCH_IN_PROGRESS != s.GettheStatus())
+		{
+			aQuery.theQueryIsPending = false;
+			aQuery.theLatency = (INTERNAL_TYPES::u64) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aQuery.theSubmission).count();
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::Tick/1
+//
+// Every pending query ages by one tick; the queries served during the tick are made young again, so
+// that those left out of this tick come first during the next ticks. When there is time left after
+// all the pending queries were served once, they are served again in a new round.
+//
+bool Scheduler::Tick(unsigned int someThreads) {
+	++theTicks;
+	theEndOftheTick = std::chrono::steady_clock::now() + std::chrono::microseconds(theTickBudget);
+
+	for (std::vector<Query>::size_type q = 0; q < theQueries.size(); ++q)
+		if (theQueries[q].theQueryIsPending)
+			++theQueries[q].theAge;
+
+	bool aQueryIsPending = true;
+	while (aQueryIsPending && (std::chrono::steady_clock::now() < theEndOftheTick))
+	{
+		// 1. Order the pending queries
+		theOrder.clear();
+		for (std::vector<Query>::size_type q = 0; q < theQueries.size(); ++q)
+			if (theQueries[q].theQueryIsPending)
+				theOrder.push_back((HQuery) q);
+		if (theOrder.empty())
+			break;
+		std::stable_sort(theOrder.begin(), theOrder.end(), Greater_Priority(theQueries));
+		theNextInOrder.store(0);
+
+		// 2. Serve them
+#if (STL == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+		// This thread serves too
+		std::vector<std::thread> theThreads;
+		for (unsigned int t = 1; (t < someThreads) && (t < theOrder.size()); ++t)
+			theThreads.push_back(std::thread(&Scheduler::Serve, this));
+		Scheduler::Serve();
+		for (std::vector<std::thread>::size_type t = 0; t < theThreads.size(); ++t)
+			theThreads[t].join();
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION)
+		// These allocators are not thread-safe: this thread alone serves the queries
+		(void) someThreads;
+		Scheduler::Serve();
+#else
+		#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+		#error MEMORY_ALLOCATION
+#endif
+
+		// 3. Record the latencies of the queries which ended during this round
+		aQueryIsPending = false;
+		for (std::vector<HQuery>::size_type o = 0; o < theOrder.size(); ++o)
+			if (theQueries[theOrder[o]].theQueryIsPending)
+				aQueryIsPending = true;
+			else
+				theLatencies.push_back(theQueries[theOrder[o]].theLatency);
+	}
+
+	for (std::vector<Query>::size_type q = 0; q < theQueries.size(); ++q)
+		if (theQueries[q].theQueryIsPending)
+			return true;
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::Latency/1
+//
+// The nearest-rank percentile: e.g. Latency(50.0) is the median and Latency(99.0) the tail latency.
+//
+INTERNAL_TYPES::u64 Scheduler::Latency(double aPercentile) const {
+	if (theLatencies.empty())
+		return 0;
+
+	std::vector<INTERNAL_TYPES::u64> someLatencies(theLatencies);
+	std::sort(someLatencies.begin(), someLatencies.end());
+
+	if (aPercentile <= 0.0)
+		return someLatencies.front();
+	if (100.0 <= aPercentile)
+		return someLatencies.back();
+
+	std::vector<INTERNAL_TYPES::u64>::size_type aRank = (std::vector<INTERNAL_TYPES::u64>::size_type) (aPercentile * someLatencies.size() / 100.0);
+	if ((double) aRank < aPercentile * someLatencies.size() / 100.0)
+		++aRank;
+	return someLatencies[(0 == aRank) ? 0 : aRank - 1];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Scheduler::SizeOf/0
+//
+size_t Scheduler::SizeOf() {
+	size_t s = sizeof(*this) + theQueries.capacity() * sizeof(Query)
+			 + theOrder.capacity() * sizeof(HQuery)
+			 + theLatencies.capacity() * sizeof(INTERNAL_TYPES::u64);
+	for (std::vector<Query>::size_type q = 0; q < theQueries.size(); ++q)
+	{
+		s += theQueries[q].theSearch.capacity() + theQueries[q].theSSFC->SizeOf();
+		if (0 != theQueries[q].theHeuristic)
+			s += theQueries[q].theHeuristic->SizeOf();
+	}
+
+	return s;
+}
+
+// ================================================================================================ End of file "Scheduler.cpp"
@@ -0,0 +1,132 @@
+// ================================================================================================ Beginning of file "Scheduler.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_SCHEDULER_H
+#define _SPHG_PLANNER_SCHEDULER_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <atomic>		// Visibility for std::atomic
+#include <chrono>		// Visibility for std::chrono::steady_clock
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the queries of the scheduler
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32 and u64
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"					// Visibility for Domain and Domain::HProblem
+#endif
+
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+	#include "Heuristic.h"				// Visibility for Heuristic
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Identifier
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"	// Visibility for StateSpaceForwardChaining
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// Many searches, one per query (e.g. one per agent of a game), share the time of a tick: each call to
+// Tick/1 spends at most theTickBudget microseconds expanding slices of the pending queries, so that no
+// query blocks the others. A query is given slices of theSliceExpansions times its priority nodes, in
+// the order of its priority plus its age, i.e. the number of ticks it waited since its last slice: a
+// query left out of a tick is served earlier during the next ticks. Each query is named as with
+// option -s of the console application; only the searches which can be started and stepped (cf.
+// StateSpaceForwardChaining::Step/1) may be scheduled.
+//
+class Scheduler {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HQuery;				// At most 4294967296 queries in a scheduler
+		static const HQuery NO_QUERY = 0xFFFFFFFF;
+
+	private:
+		struct Query {
+			PDDL::Identifier					theSearch;			// The name of the search, e.g. "astar-lmcut"
+			StateSpaceForwardChaining*			theSSFC;			// The search structures of this query, owned by the scheduler
+			Heuristic*							theHeuristic;		// The heuristic of theSSFC, owned by the scheduler; 0 when the search needs none
+			INTERNAL_TYPES::u32					thePriority;		// At least 1: the number of slices this query is given at once
+			INTERNAL_TYPES::u32					theAge;				// The number of ticks since this query was last given a slice
+			bool								theQueryIsPending;	// Until the search of theSSFC ends
+			bool								thePlanIsFound;
+			std::chrono::steady_clock::time_point	theSubmission;	// When the query was added
+			INTERNAL_TYPES::u64					theLatency;			// The microseconds from theSubmission to the end of the search
+		};
+		struct Greater_Priority {									// Has the left query a greater priority plus age than the right query? Break ties with their order of submission
+			const std::vector<Query>*			theQueries;
+			explicit Greater_Priority(const std::vector<Query>& someQueries) : theQueries(&someQueries) {}
+			bool operator() (HQuery left, HQuery right) const {
+				const INTERNAL_TYPES::u64 l = (INTERNAL_TYPES::u64) (*theQueries)[left].thePriority + (*theQueries)[left].theAge;
+				const INTERNAL_TYPES::u64 r = (INTERNAL_TYPES::u64) (*theQueries)[right].thePriority + (*theQueries)[right].theAge;
+				return ((l > r) || ((l == r) && (left < right)));
+			}
+		};
+
+
+	// ----- Properties
+	private:
+		Domain*									theDomain;				// The PDDL Domain of all the queries
+		std::vector<Query>						theQueries;
+		INTERNAL_TYPES::u64						theTickBudget;			// The microseconds of a tick
+		INTERNAL_TYPES::u32						theSliceExpansions;		// The nodes a query of priority 1 expands in a slice
+		std::vector<HQuery>						theOrder;				// The pending queries of the current tick, served in this order
+		std::atomic<std::vector<HQuery>::size_type>	theNextInOrder;		// The next query of theOrder a thread serves
+		std::chrono::steady_clock::time_point	theEndOftheTick;
+		std::vector<INTERNAL_TYPES::u64>		theLatencies;			// The microseconds from the submission to the end of each query which ended
+		INTERNAL_TYPES::u32						theTicks;				// The number of calls to Tick/1
+
+
+	// ----- Constructors
+	public:
+		Scheduler(Domain& aDomain, INTERNAL_TYPES::u64 aTickBudget, INTERNAL_TYPES::u32 aSliceExpansions);
+
+	private:
+		Scheduler(const Scheduler&);				// The queries are owned by one scheduler only...
+		Scheduler& operator=(const Scheduler&);		// ... and never shared
+
+
+	// ----- Destructor
+	public:
+		~Scheduler();
+
+
+	// ----- Accessors
+	public:
+		inline HQuery Size() const { return (HQuery) theQueries.size(); }
+		inline bool IsPending(HQuery aQuery) const { return theQueries[aQuery].theQueryIsPending; }
+		inline bool IsPlanFound(HQuery aQuery) const { return theQueries[aQuery].thePlanIsFound; }
+		inline const PDDL::Identifier& GettheSearch(HQuery aQuery) const { return theQueries[aQuery].theSearch; }
+		inline StateSpaceForwardChaining& GettheSSFC(HQuery aQuery) { return *theQueries[aQuery].theSSFC; }
+		inline INTERNAL_TYPES::u32 GettheTicks() const { return theTicks; }
+		inline std::vector<INTERNAL_TYPES::u64>::size_type GettheNumberOfLatencies() const { return theLatencies.size(); }
+
+
+	// ----- Operations
+	public:
+		static bool IsAvailable(const PDDL::Identifier& aSearch);	// Can aSearch be scheduled?
+
+		HQuery Add(Domain::HProblem aProblem, const PDDL::Identifier& aSearch, INTERNAL_TYPES::u32 aPriority = 1);	// Build and start the search of a new query; NO_QUERY when aSearch is not available or cannot start
+
+		bool Tick(unsigned int someThreads = 1);	// Serve the pending queries during theTickBudget, with someThreads threads; true while some query is pending
+
+		INTERNAL_TYPES::u64 Latency(double aPercentile) const;	// The latency, in microseconds, under which aPercentile (in [0, 100]) of the ended queries ended; 0 when none ended
+
+		size_t SizeOf();
+
+	private:
+		void Serve();	// The work of one thread during a tick: take the next query of theOrder and expand a slice of it, until the tick ends or theOrder is done
+};
+
+#endif	// _SPHG_PLANNER_SCHEDULER_H
+// ================================================================================================ End of file "Scheduler.h"
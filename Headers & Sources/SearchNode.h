@@ -0,0 +1,78 @@
+// ================================================================================================ Beginning of file "SearchNode.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_SEARCH_NODE_H
+#define _SPHG_PLANNER_SEARCH_NODE_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <vector>		// STL Store house for the search nodes
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Number
+#endif
+
+#ifndef _SPHG_PLANNER_OPERATOR_H
+	#include "Operator.h"				// Visibility for Operator::HOperatorSignature
+#endif
+
+#ifndef _SPHG_PLANNER_STATE_REGISTRY_H
+	#include "StateRegistry.h"			// Visibility for StateRegistry::HState
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// A node of the search space: a state, the operator signature which produced it and the node this
+// operator was applied to. The size of a node does not depend on its depth: the plan leading to a
+// node is only built, by walking up the parents, when this node is a solution.
+//
+class SearchNode {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HNode;				// At most 4294967296 nodes in a search
+
+		static const HNode NO_NODE = 0xFFFFFFFF;					// The parent of the root node
+
+
+	// ----- Properties
+	private:
+		StateRegistry::HState					theState;				// The state of this node, in the StateRegistry of the search
+		HNode									theParent;				// The node this node is a child of
+		Operator::HOperatorSignature			theOperatorSignature;	// The operator signature applied to the state of theParent which produced theState
+		PDDL::Number							theCost;				// The cost of the plan from the root node to this node
+
+
+	// ----- Constructors
+	public:
+		SearchNode(StateRegistry::HState aState, HNode aParent, Operator::HOperatorSignature anOperatorSignature, PDDL::Number aCost) :
+			theState(aState),
+			theParent(aParent),
+			theOperatorSignature(anOperatorSignature),
+			theCost(aCost) {}
+		explicit SearchNode(StateRegistry::HState theInitialState) :
+			theState(theInitialState),
+			theParent(NO_NODE),
+			theOperatorSignature(0),
+			theCost(0.0f) {}
+
+
+	// ----- Accessors
+	public:
+		inline StateRegistry::HState GettheState() const { return theState; }
+		inline HNode GettheParent() const { return theParent; }
+		inline Operator::HOperatorSignature GettheOperatorSignature() const { return theOperatorSignature; }
+		inline PDDL::Number GettheCost() const { return theCost; }
+};
+
+typedef		std::vector<SearchNode>		SearchNodes;		// All the nodes generated by a search; a SearchNode::HNode is a position in SearchNodes
+
+#endif	// _SPHG_PLANNER_SEARCH_NODE_H
+// ================================================================================================ End of file "SearchNode.h"
\ No newline at end of file
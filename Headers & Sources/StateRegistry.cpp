@@ -0,0 +1,338 @@
+// ================================================================================================ Beginning of file "StateRegistry.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//			  MaketheKeys/0 --- The random keys of the predicates
+//					 Keys/0 --- Same as MaketheKeys/0, made on first use only
+//					 Hash/1 --- 64 bits hash value of a state
+//				   Insert/1 --- Store a state in the arena when it is not already there
+//				   Insert/2 --- Same as Insert/1 with the hash value of the state
+//				   Insert/3 --- Same as Insert/1 with the parent of the state
+//				   Insert/4 --- Same as Insert/2 with the predicates toggled from the parent of the state
+//					 Find/1 --- Look for a state in the arena
+//					 Find/2 --- Same as Find/1 with the hash value of the state
+//					 Grow/0 --- Double the number of slots of the hash table
+//					Store/4 --- Append a state to the arena
+//				  IsEqual/3 --- Is a state of the arena equal to a state?
+//				  Rebuild/2 --- Toggle the predicates of the deltas of a state, back to its checkpoint
+//				  Restore/2 --- Store again all the states of the arena
+//					 Pack/1 --- Store the states packed, or not
+//				 Compress/1 --- Store the states as deltas, or not
+//					Clear/0 --- Empty the registry
+//				   SizeOf/0 --- Memory size of the registry
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"		// Visibility for NUMBER_OF_SLOTS_IN_A_STATE
+#endif
+
+#ifndef _SPHG_PLANNER_STATE_REGISTRY_H
+	#include "StateRegistry.h"				// Class visibility
+#endif
+
+// The hash table initially has 2^6 slots and is at most half full
+#define SPHG_REGISTRY_INITIAL_SLOTS		64
+
+// A compressed state is rebuilt from at most 16 deltas, its checkpoint included
+#define SPHG_REGISTRY_CHECKPOINT_PERIOD	16
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const StateRegistry::HState StateRegistry::NO_STATE;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// MaketheKeys/0
+//
+// The finalizer of MurmurHash3 scatters the position of each predicate over all the bits of its key,
+// the low bits (those used to choose a slot of the hash table) included
+//
+static const StateRegistry::HashValue* MaketheKeys() {
+	static StateRegistry::HashValue someKeys[NUMBER_OF_SLOTS_IN_A_STATE * 64];
+	for (State::index_type i = 0; i < State::end(); ++i)
+	{
+		StateRegistry::HashValue h = 0x9e3779b97f4a7c15ULL * (i + 1);
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+		someKeys[i] = h;
+	}
+
+	return someKeys;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Keys/0
+//
+// The keys are made on first use, so that no static initialization of another file hashes a state
+// before they exist
+//
+static const StateRegistry::HashValue* Keys() {
+	static const StateRegistry::HashValue* const theKeys = MaketheKeys();
+
+	return theKeys;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Hash/1
+//
+// Zobrist hashing: the xor of the keys of the predicates of aState
+//
+StateRegistry::HashValue StateRegistry::Hash(const State& aState) {
+	const HashValue* theKeys = Keys();
+	HashValue h = 0;
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+		h ^= theKeys[i];
+
+	return h;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Insert/1
+//
+std::pair<StateRegistry::HState, bool> StateRegistry::Insert(const State& aState) {
+	return StateRegistry::Insert(aState, StateRegistry::Hash(aState));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Insert/2
+//
+std::pair<StateRegistry::HState, bool> StateRegistry::Insert(const State& aState, HashValue h) {
+	return StateRegistry::Insert(aState, h, NO_STATE, aState);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Insert/3
+//
+// A state and its parent usually differ by a few predicates: the hash value of the parent is updated
+// with the keys of these predicates only, and they make the delta of the state when it is compressed
+//
+std::pair<StateRegistry::HState, bool> StateRegistry::Insert(const State& aState, HState aParent, const State& aParentState) {
+	State someToggles(aState);
+	someToggles.remove(aParentState);
+	State someDeletions(aParentState);
+	someDeletions.remove(aState);
+	someToggles.add(someDeletions);
+
+	const HashValue* theKeys = Keys();
+	HashValue h = theHashValues[aParent];
+	for (State::index_type i = someToggles.first(); i < State::end(); i = someToggles.next(i))
+		h ^= theKeys[i];
+
+	return StateRegistry::Insert(aState, h, aParent, someToggles);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Insert/4
+//
+std::pair<StateRegistry::HState, bool> StateRegistry::Insert(const State& aState, HashValue h, HState aParent, const State& someToggles) {
+	// Keep the hash table at most half full so that linear probing stays short
+	if (2 * (theHashValues.size() + 1) > theSlots.size())
+		StateRegistry::Grow();
+
+	// A state which is not reachable may not be packed: all the states are stored as States from now on
+	MutexGroups::Word aPackedState[NUMBER_OF_SLOTS_IN_A_STATE];	// A packed state is smaller than a State (cf. MutexGroups::IsCompact/0)
+	if (StateRegistry::IsPacked() && !theMutexGroups->Pack(aState, aPackedState))
+		StateRegistry::Restore(0, theCheckpointPeriod);
+
+	for (size_type slot = (size_type) h & theMask; ; slot = (slot + 1) & theMask)
+	{
+		HState s = theSlots[slot];
+		if (NO_STATE == s)
+		{
+			// aState is new: append it to the arena and remember it in this empty slot
+			s = (HState) theHashValues.size();
+			StateRegistry::Store(aState, aPackedState, aParent, someToggles);
+			theHashValues.push_back(h);
+			theSlots[slot] = s;
+
+			return std::pair<HState, bool>(s, true);
+		}
+		else if ((h == theHashValues[s]) && StateRegistry::IsEqual(s, aState, aPackedState))
+			return std::pair<HState, bool>(s, false);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Find/1
+//
+StateRegistry::HState StateRegistry::Find(const State& aState) const {
+	return StateRegistry::Find(aState, StateRegistry::Hash(aState));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Find/2
+//
+// Find/2 only reads the registry: several threads may look for states at the same time, as long as none inserts
+//
+StateRegistry::HState StateRegistry::Find(const State& aState, HashValue h) const {
+	// The registry holds no state which may not be packed
+	MutexGroups::Word aPackedState[NUMBER_OF_SLOTS_IN_A_STATE];
+	if (StateRegistry::IsPacked() && !theMutexGroups->Pack(aState, aPackedState))
+		return NO_STATE;
+
+	for (size_type slot = (size_type) h & theMask; ; slot = (slot + 1) & theMask)
+	{
+		HState s = theSlots[slot];
+		if (NO_STATE == s)
+			return NO_STATE;
+		else if ((h == theHashValues[s]) && StateRegistry::IsEqual(s, aState, aPackedState))
+			return s;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Grow/0
+//
+void StateRegistry::Grow() {
+	theSlots.assign(2 * theSlots.size(), NO_STATE);
+	theMask = (size_type) theSlots.size() - 1;
+
+	// Re-insert all the states with their memorized hash values; all the states are different
+	for (HState s = 0; s < theHashValues.size(); ++s)
+	{
+		size_type slot = (size_type) theHashValues[s] & theMask;
+		while (NO_STATE != theSlots[slot])
+			slot = (slot + 1) & theMask;
+		theSlots[slot] = s;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Store/4
+//
+// A compressed state is a checkpoint when it has no parent, when the deltas from its parent to their
+// checkpoint are long enough, or when toggling its predicates is not shorter than listing them
+//
+void StateRegistry::Store(const State& aState, const MutexGroups::Word* aPackedState, HState aParent, const State& someToggles) {
+	if (0 != theCheckpointPeriod)
+	{
+		if ((NO_STATE == aParent) || (theCheckpointPeriod <= theDepths[aParent] + 1u) || (aState.size() <= someToggles.size()))
+		{
+			theParents.push_back(NO_STATE);
+			theDepths.push_back(0);
+			for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+				theToggles.push_back((PDDL::HPredicate) i);
+		}
+		else
+		{
+			theParents.push_back(aParent);
+			theDepths.push_back((INTERNAL_TYPES::u8) (theDepths[aParent] + 1));
+			for (State::index_type i = someToggles.first(); i < State::end(); i = someToggles.next(i))
+				theToggles.push_back((PDDL::HPredicate) i);
+		}
+		theDeltas.push_back((INTERNAL_TYPES::u32) theToggles.size());
+	}
+	else if (0 == theMutexGroups)
+		theArena.push_back(aState);
+	else
+		thePackedArena.insert(thePackedArena.end(), aPackedState, aPackedState + theWordsPerState);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::IsEqual/3
+//
+bool StateRegistry::IsEqual(HState s, const State& aState, const MutexGroups::Word* aPackedState) const {
+	if (0 != theCheckpointPeriod)
+	{
+		State aStoredState;
+		StateRegistry::Rebuild(s, aStoredState);
+		return (aStoredState == aState);
+	}
+	if (0 == theMutexGroups)
+		return (theArena[s] == aState);
+
+	const MutexGroups::Word* aStoredState = &thePackedArena[s * theWordsPerState];
+	for (INTERNAL_TYPES::u32 w = 0; w < theWordsPerState; ++w)
+		if (aStoredState[w] != aPackedState[w])
+			return false;
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Rebuild/2
+//
+// Each predicate toggled an even number of times along the deltas is not in the state: the order of
+// the deltas does not matter
+//
+void StateRegistry::Rebuild(HState s, State& aState) const {
+	aState.clear();
+	for (; NO_STATE != s; s = theParents[s])
+		for (INTERNAL_TYPES::u32 t = theDeltas[s]; t < theDeltas[s + 1]; ++t)
+			if (aState.find(theToggles[t]))
+				aState.erase(theToggles[t]);
+			else
+				aState.insert(theToggles[t]);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Restore/2
+//
+// The states already stored are stored again, with the same HState and hash value; they all become checkpoints
+//
+void StateRegistry::Restore(const MutexGroups* someMutexGroups, INTERNAL_TYPES::u32 aCheckpointPeriod) {
+	std::vector<State> someStates;
+	for (HState s = 0; s < StateRegistry::Size(); ++s)
+		someStates.push_back(StateRegistry::GettheState(s));
+
+	// The states are not packed when one of them may not be
+	MutexGroups::Word aPackedState[NUMBER_OF_SLOTS_IN_A_STATE];
+	for (std::vector<State>::size_type s = 0; (0 != someMutexGroups) && (s < someStates.size()); ++s)
+		if (!someMutexGroups->Pack(someStates[s], aPackedState))
+			someMutexGroups = 0;
+
+	theArena.clear();
+	thePackedArena.clear();
+	theParents.clear();
+	theDepths.clear();
+	theDeltas.assign(1, 0);
+	theToggles.clear();
+	theMutexGroups = someMutexGroups;
+	theWordsPerState = (0 == someMutexGroups) ? 0 : someMutexGroups->GettheNumberOfWords();
+	theCheckpointPeriod = aCheckpointPeriod;
+
+	for (std::vector<State>::size_type s = 0; s < someStates.size(); ++s)
+	{
+		if (StateRegistry::IsPacked())
+			theMutexGroups->Pack(someStates[s], aPackedState);
+		StateRegistry::Store(someStates[s], aPackedState, NO_STATE, someStates[s]);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Pack/1
+//
+// A packed state must be smaller than a State; the states stay States when one of them is not reachable
+// from the initial state of someMutexGroups. Clear/0 forgets the states, not someMutexGroups.
+//
+void StateRegistry::Pack(const MutexGroups* someMutexGroups) {
+	StateRegistry::Restore(someMutexGroups, theCheckpointPeriod);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Compress/1
+//
+// Clear/0 forgets the states, not their compression
+//
+void StateRegistry::Compress(bool aCompression) {
+	StateRegistry::Restore(theMutexGroups, aCompression ? SPHG_REGISTRY_CHECKPOINT_PERIOD : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::Clear/0
+//
+void StateRegistry::Clear() {
+	theArena.clear();
+	thePackedArena.clear();
+	theParents.clear();
+	theDepths.clear();
+	theDeltas.assign(1, 0);
+	theToggles.clear();
+	theHashValues.clear();
+	theSlots.assign(SPHG_REGISTRY_INITIAL_SLOTS, NO_STATE);
+	theMask = SPHG_REGISTRY_INITIAL_SLOTS - 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateRegistry::SizeOf/0
+//
+size_t StateRegistry::SizeOf() const {
+	return (sizeof(*this)
+			+ theArena.capacity() * sizeof(State)
+			+ thePackedArena.capacity() * sizeof(MutexGroups::Word)
+			+ theParents.capacity() * sizeof(HState)
+			+ theDepths.capacity() * sizeof(INTERNAL_TYPES::u8)
+			+ theDeltas.capacity() * sizeof(INTERNAL_TYPES::u32)
+			+ theToggles.capacity() * sizeof(PDDL::HPredicate)
+			+ theHashValues.capacity() * sizeof(HashValue)
+			+ theSlots.capacity() * sizeof(HState));
+}
+
+// ================================================================================================ End of file "StateRegistry.cpp"
\ No newline at end of file
@@ -0,0 +1,126 @@
+// ================================================================================================ Beginning of file "StateRegistry.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_STATE_REGISTRY_H
+#define _SPHG_PLANNER_STATE_REGISTRY_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <utility>		// Visibility for std::pair
+#include <vector>		// STL Store house for the states, the hash values and the slots of the registry
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32 and u64
+#endif
+
+#ifndef _SPHG_PLANNER_MUTEX_GROUPS_H
+	#include "MutexGroups.h"			// Visibility for MutexGroups
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// The closed set of a search: each State reached during the search is stored once, and only once,
+// in a single contiguous arena of fixed width States; a State is then designated by its (stable)
+// position in the arena, its HState. An open addressing hash table (linear probing over a power of
+// 2 number of slots) answers whether a State has already been reached.
+//
+// Once Pack/1 has been given the MutexGroups of the problem, the arena holds the packed states
+// instead: a few Words per state, where the mutex predicates share the bits of their variable.
+// The hash values are those of the States, and GettheState/1 unpacks a copy of the State. The first
+// state which may not be packed (cf. MutexGroups::Pack/2) stores all the states as States again.
+//
+// Once Compress/1 has been asked to, each state is stored as a delta instead: the few predicates it
+// toggles from its parent state (cf. Insert/3), or all its predicates for a checkpoint, which a chain
+// of deltas reaches at least every SPHG_REGISTRY_CHECKPOINT_PERIOD states. GettheState/1 then toggles
+// the predicates of the deltas back to the checkpoint; the States compared when inserting a state are
+// rebuilt as well, which trades some time for a lot of memory. Compress/1 overrides Pack/1.
+//
+// The hash value of a State is the xor of the (random) keys of its predicates, so that the hash value
+// of a child state is the one of its parent xored with the keys of the predicates it toggles.
+//
+class StateRegistry {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HState;				// At most 4294967296 states in this registry
+		typedef		INTERNAL_TYPES::u32			size_type;			// At most 4294967296 slots in the hash table of this registry
+		typedef		INTERNAL_TYPES::u64			HashValue;			// 64 bits hash value of a State
+
+		static const HState NO_STATE = 0xFFFFFFFF;					// Marks an empty slot of the hash table; also means "no such state"
+
+
+	// ----- Properties
+	private:
+		std::vector<State>						theArena;			// All the states, one state after the other: HState s is theArena[s]...
+		std::vector<MutexGroups::Word>			thePackedArena;		// ... or, when theMutexGroups pack them, the theWordsPerState Words from thePackedArena[s * theWordsPerState]
+		const MutexGroups*						theMutexGroups;		// The encoding of the packed states; 0 when the states are not packed
+		INTERNAL_TYPES::u32						theWordsPerState;
+		INTERNAL_TYPES::u32						theCheckpointPeriod;// 0 unless the states are stored as deltas (cf. Compress/1): then...
+		std::vector<HState>						theParents;			// ... the state each delta applies to, NO_STATE for a checkpoint...
+		std::vector<INTERNAL_TYPES::u8>			theDepths;			// ... the number of deltas from a state to its checkpoint...
+		std::vector<INTERNAL_TYPES::u32>		theDeltas;			// ... and the predicates toggled by HState s, from theToggles[theDeltas[s]] to theToggles[theDeltas[s + 1]]
+		std::vector<PDDL::HPredicate>			theToggles;
+		std::vector<HashValue>					theHashValues;		// The hash value of each state, so as to never compute it twice
+		std::vector<HState>						theSlots;			// The open addressing hash table; its size always is a power of 2
+		size_type								theMask;			// theSlots.size() - 1
+
+
+	// ----- Constructors
+	public:
+		StateRegistry() : theMutexGroups(0), theWordsPerState(0), theCheckpointPeriod(0) { StateRegistry::Clear(); }
+
+
+	// ----- Accessors
+	public:
+		inline HState Size() const { return (HState) theHashValues.size(); }
+		inline State GettheState(HState s) const {
+			if ((0 == theCheckpointPeriod) && (0 == theMutexGroups))
+				return theArena[s];
+			State aState;
+			if (0 != theCheckpointPeriod)
+				StateRegistry::Rebuild(s, aState);
+			else
+				theMutexGroups->Unpack(&thePackedArena[s * theWordsPerState], aState);
+			return aState;
+		}
+		inline bool IsPacked() const { return ((0 == theCheckpointPeriod) && (0 != theMutexGroups)); }
+		inline bool IsCompressed() const { return (0 != theCheckpointPeriod); }
+		inline INTERNAL_TYPES::u32 GettheCheckpointPeriod() const { return theCheckpointPeriod; }
+		inline HashValue GettheHashValue(HState s) const { return theHashValues[s]; }
+
+
+	// ----- Operations
+	public:
+		static HashValue Hash(const State& aState);
+
+		std::pair<HState, bool> Insert(const State& aState);	// .second is true when aState was not in this registry before
+		std::pair<HState, bool> Insert(const State& aState, HashValue h);	// Same as Insert/1, when h = Hash(aState) is already known
+		std::pair<HState, bool> Insert(const State& aState, HState aParent, const State& aParentState);	// Same as Insert/1, hashing only the predicates aState toggles from aParentState
+		HState Find(const State& aState) const;					// NO_STATE when aState is not in this registry
+		HState Find(const State& aState, HashValue h) const;	// Same as Find/1, when h = Hash(aState) is already known
+
+		void Pack(const MutexGroups* someMutexGroups);			// The states are stored packed by someMutexGroups from now on, or as States when 0
+		void Compress(bool aCompression);						// The states are stored as deltas to their parents from now on, or not
+
+		void Clear();
+		size_t SizeOf() const;
+
+	private:
+		std::pair<HState, bool> Insert(const State& aState, HashValue h, HState aParent, const State& someToggles);
+		void Grow();
+		void Store(const State& aState, const MutexGroups::Word* aPackedState, HState aParent, const State& someToggles);	// Append a state to the arena
+		bool IsEqual(HState s, const State& aState, const MutexGroups::Word* aPackedState) const;
+		void Rebuild(HState s, State& aState) const;			// Toggle the predicates of the deltas of s
+		void Restore(const MutexGroups* someMutexGroups, INTERNAL_TYPES::u32 aCheckpointPeriod);	// Store again all the states
+};
+
+#endif	// _SPHG_PLANNER_STATE_REGISTRY_H
+// ================================================================================================ End of file "StateRegistry.h"
\ No newline at end of file
@@ -1,1293 +1,3276 @@
-// ================================================================================================ Beginning of file "StateSpaceForwardChaining.cpp"
-// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
-/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
-//
-//	  StateSpaceForwardChaining/2 --- Constructs various search structures from the domain and the problem
-//	 ~StateSpaceForwardChaining/0 --- Frees the space allocated with theStateIndexedByPredicates
-//						  Reset/0 --- Must be called between two successive searches for the same problem
-//						  Apply/4 --- Make a new state when all the preconditions have been unified and all parameters are valued
-//		   UnifyPreconditions/4-5 --- Unify each of the positive preconditions of this operator with predicates from the current situation
-//				  BreadthExpand/0 --- Apply the domain operators to the state of the front Plan of the search frontier and push back the new plans
-//				   BreadthFirst/1 --- Expands the shallowest plan in the state space first
-//					 CostExpand/0 --- Apply the domain operators to the state of the lowest cost Plan of the search frontier and push the new plans with updated costs
-//					  BestFirst/0 --- Expands the least cost plan in the state space first
-//							Put/4 --- Writing (a plan + its resulting state) to an ostream
-//						 SizeOf/0 --- Computes the memory used by this search
-//			ConvertthePlanFound/0 --- Consert (the plan found by the search) to the user's desired type
-//			ConvertthePlanFound/1 --- Consert (the plan found by the search) to the some STL structure
-//	ConvertthePlanFoundToString/0 --- Putting the actions and parameters identifiers into an std::string
-//
-///////////////////////////////////////////////////////////////////////////////////////////////////
-//
-/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
-//
-// STL and STD files
-#include <iostream>						// Visibility for std::cout, std::endl
-#include <map>							// Accessing the table of string constants for this search
-#include <math.h>						// Visibility for floor/1 and log10/1
-
-// Project files
-#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
-	#include "ConditionalCompiling.h"		// Visibility for MEMORY_ALLOCATION, STL, HPHA, CLASSIC
-#endif
-
-#ifndef _SPHG_PLANNER_OPERATOR_H
-	#include "Operator.h"
-#endif
-
-#ifndef _SPHG_PLANNER_PREDICATE_H
-	#include "Predicate.h"
-#endif
-
-#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
-	#include "StateSpaceForwardChaining.h"	// Class visibility
-#endif
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StateSpaceForwardChaining/2
-//
-StateSpaceForwardChaining::StateSpaceForwardChaining(Domain& aDomain, Domain::HProblem aProblem) : theCostOfthePlanFound(0.0f) {
-	// Set the pointers which hold necessary data for this search
-	theDomain = &aDomain;
-	theProblem = aProblem;
-
-	// Build the table of string constants for this search
-	for (std::map<PDDL::HIdentifier, PDDL::Identifier>::const_iterator i = ((theDomain->GettheProblem(theProblem))->GettheConstants()).begin(); i != ((theDomain->GettheProblem(theProblem))->GettheConstants()).end(); ++i)
-		theIdentifiers.push_back(i->second);
-
-	// Get the table of shared predicates for this search
-	//	1. First, get the the shared predicates from theDomain
-	theSharedPredicates = theDomain->GetthePredicates();
-
-	//	2. Second, get the shared predicates from theProblem
-	std::vector<Predicate> Temp = (theDomain->GettheProblem(theProblem))->GetthePredicates();
-	for (PDDL::HPredicate p = 0; p < Temp.size(); ++p)
-		theSharedPredicates.push_back(Temp[p]);
-
-	//	3. Remember the current number of shared predicates in order to ease future searches
-	theSizeOftheSharedPredicates = (PDDL::HPredicate) theSharedPredicates.size();
-
-	// Set the initial and final state of the problem for this search
-	theInitialState = theStates.insert(std::pair<State, Plan::length_type>(Convert((theDomain->GettheProblem(aProblem))->GetthePositiveInitialState()), 0)).first;
-	theFinalState =  theStates.insert(std::pair<State, Plan::length_type>(Convert((theDomain->GettheProblem(aProblem))->GetthePositiveGoalState()), 0)).first;
-
-	// Build theStatePredicates from theInitialState and theFinalState
-	for (PDDL::HPredicate i = 0; i < (theInitialState->first).size(); ++i)
-		theStatesPredicates[theSharedPredicates[((theInitialState->first)[i])]] = ((theInitialState->first)[i]);
-	for (PDDL::HPredicate i = 0; i < (theFinalState->first).size(); ++i)
-		theStatesPredicates[theSharedPredicates[((theFinalState->first)[i])]] = ((theFinalState->first)[i]);
-
-	// Finally, register this search for aProblem
-	(theDomain->GettheProblem(aProblem))->Register(this);
-
-	// One more thing... Initialize map from the predicate identifiers to the predicates in the current state
-	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
-	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
-		theStateIndexedByPredicates.push_back(new std::vector<PDDL::HPredicate>);
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::~StateSpaceForwardChaining/0
-//
-StateSpaceForwardChaining::~StateSpaceForwardChaining() {
-	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
-	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
-		delete theStateIndexedByPredicates[i];
-}
-
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Reset/0
-//
-void StateSpaceForwardChaining::Reset() {
-	// Reset the table of shared predicates for this search
-	theSharedPredicates.resize(theSizeOftheSharedPredicates);
-
-	// Reset the initial and final state of the problem for this search:
-	//	1. Create a temporary store for both the initial and final states of the problem
-	States Temp;
-	theInitialState = (Temp.insert((*theInitialState))).first;
-	theFinalState = (Temp.insert((*theFinalState))).first;
-	//	2. Make theStates fresh with theInitialState and theFinalState of the problem
-	theStates.clear();
-	theInitialState = (theStates.insert((*theInitialState))).first;
-	theFinalState = (theStates.insert((*theFinalState))).first;
-
-	// Build theStatePredicates from theInitialState and theFinalState
-	theStatesPredicates.clear();
-	for (PDDL::HPredicate i = 0; i < (theInitialState->first).size(); ++i)
-		theStatesPredicates[theSharedPredicates[((theInitialState->first)[i])]] = ((theInitialState->first)[i]);
-	for (PDDL::HPredicate i = 0; i < (theFinalState->first).size(); ++i)
-		theStatesPredicates[theSharedPredicates[((theFinalState->first)[i])]] = ((theFinalState->first)[i]);
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Apply/4
-//
-#if (STL == MEMORY_ALLOCATION)
-State StateSpaceForwardChaining::Apply(const State& aCurrentState, const Operator* Op, Operator::Predicates& D, PDDL::Parameters P) {
-
-		TemporaryState newCurrentState = Convert(aCurrentState);	// the state resulting from deleting the deletions and adding the additions
-
-		Operator::HPredicate thePositionOfDeletedPreconditions = Op->GetthePositionOfDeletedPreconditions();
-		Operator::HPredicate thePositionOfDeletions = Op->GetthePositionOfDeletions();
-		Operator::HPredicate thePositionOfAdditions = Op->GetthePositionOfAdditions();
-		Operator::HPredicate thePositionOfNegativePreconditions = Op->GetthePositionOfNegativePreconditions();
-
-		// Substract the deleted preconditions from aCurrentState (results in newCurrentState)
-		for (Operator::HPredicate del_pre = thePositionOfDeletedPreconditions; del_pre < thePositionOfDeletions; ++del_pre)
-		{
-			// In this range, all the predicates in D are preconditions which are deleted; consequently, 
-			// erase/1 shall return 0; we disgard this returned value because we are in the good range.
-			newCurrentState.erase(D[del_pre]);		// erase/1 returns the number of elements that have been removed from the set
-		}
-
-		for (Operator::HPredicate del = thePositionOfDeletions; del < thePositionOfAdditions; ++del)
-		{
-			// In this range, all the predicates only belong to the delete list.
-			// Get the position of this deleted predicate in theStatesPredicates and delete it in a newCurrentState
-			// (after the predicate parameters have been updated with the instantiated parameters of this Operator)
-			StateSpaceForwardChaining::StatePredicates::const_iterator it = StateSpaceForwardChaining::Find( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(del)).UpdatetheParameters(P));
-			if (StateSpaceForwardChaining::Found(it))
-			{
-				newCurrentState.erase(it->second);
-			}
-		}
-
-		// Union the the set of predicates of newCurrentState with the added predicates of this Operator
-		for (Operator::HPredicate add = thePositionOfAdditions; add < thePositionOfNegativePreconditions; ++add)
-		{
-			// In this range, all the predicates only belong to the add list.
-			// Get the position of anAddedPredicate in theStatesPredicates and insert it in a newCurrentState
-			// (after the predicate parameters have been updated with the instantiated parameters of this Operator)
-			newCurrentState.insert(StateSpaceForwardChaining::InsertAsSharedPredicate( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(add)).UpdatetheParameters(P)));
-		}
-
-		return Convert(newCurrentState);
-	}
-#elif (DL_MALLOC == MEMORY_ALLOCATION) ||(HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
-	State StateSpaceForwardChaining::Apply(const State& aCurrentState, const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P) {
-
-		TemporaryState newCurrentState = Convert(aCurrentState);	// the state resulting from deleting the deletions and adding the additions
-
-		Operator::HPredicate thePositionOfDeletedPreconditions = Op->GetthePositionOfDeletedPreconditions();
-		Operator::HPredicate thePositionOfDeletions = Op->GetthePositionOfDeletions();
-		Operator::HPredicate thePositionOfAdditions = Op->GetthePositionOfAdditions();
-		Operator::HPredicate thePositionOfNegativePreconditions = Op->GetthePositionOfNegativePreconditions();
-
-		// Substract the deleted preconditions from aCurrentState (results in newCurrentState)
-		for (Operator::HPredicate del_pre = thePositionOfDeletedPreconditions; del_pre < thePositionOfDeletions; ++del_pre)
-		{
-			// In this range, all the predicates in D are preconditions which are deleted; consequently, 
-			// erase/1 shall return 0; we disgard this returned value because we are in the good range.
-			newCurrentState.erase(D[del_pre]);		// erase/1 returns the number of elements that have been removed from the set
-		}
-
-		for (Operator::HPredicate del = thePositionOfDeletions; del < thePositionOfAdditions; ++del)
-		{
-			// In this range, all the predicates only belong to the delete list.
-			// Get the position of this deleted predicate in theStatesPredicates and delete this position in a newCurrentState
-			// (after the predicate parameters have been updated with the instantiated parameters of this Operator)
-			StateSpaceForwardChaining::StatePredicates::const_iterator it = StateSpaceForwardChaining::Find( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(del)).UpdatetheParameters(P));
-			if (StateSpaceForwardChaining::Found(it))
-			{
-				newCurrentState.erase(it->second);
-			}
-		}
-
-		// Union the set of predicates of newCurrentState with the added predicates of this Operator
-		for (Operator::HPredicate add = thePositionOfAdditions; add < thePositionOfNegativePreconditions; ++add)
-		{
-			// In this range, all the predicates only belong to the add list.
-			// Get the position of anAddedPredicate in theStatesPredicates and insert this position in a newCurrentState
-			// (after the predicate parameters have been updated with the instantiated parameters of this Operator)
-			newCurrentState.insert( StateSpaceForwardChaining::InsertAsSharedPredicate( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(add)).UpdatetheParameters(P)));
-		}
-
-		return Convert(newCurrentState);
-	}
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::UnifyPreconditions/4-5
-//
-#if (STL == MEMORY_ALLOCATION)
-	bool StateSpaceForwardChaining::UnifyPreconditions(const Operator* Op, Operator::Predicates& D, PDDL::Parameters P, IndexedState& aStateSortedByPredicates) {
-
-		// Check the positive preconditions
-		for (std::vector<std::vector<Operator::Positions>>::size_type par = 0; par < Op->GetthePositionsSize(); ++par)
-		{ 
-			// Check values from these state predicate parameters are all be equal
-			PDDL::HIdentifier ref = StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, 0).first]).GettheParameter(Op->GetthePosition(par, 0).second);
-			for (std::vector<Operator::Positions>::size_type pos = 1; pos < Op->GetthePositionsSize(par); ++pos)
-			{
-				if (ref != StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, pos).first]).GettheParameter(Op->GetthePosition(par,pos).second))
-					// Sorry folks but this couple of (state) predicate parameters are inconsistent
-					return false;
-			}
-
-			// All the predicate parameters are consistent for this Operator parameter par: give it a final value
-			P[par].first = PDDL::STRING_VALUE;	// Might be a useful information for debugging purposes
-			P[par].second = ref;
-		}
-
-		//// Check the positive preconditions
-		//for (Operator::HPredicate pos_pre = 0; pos_pre < thePositionOfDeletions; ++pos_pre)
-		//{
-		//	if (! (aStateSpaceForwardChaining->GetthePredicate(thePredicates[pos_pre])).Unify(aStateSpaceForwardChaining->GetthePredicate(D[pos_pre]), P))
-		//	{
-		//		 Sorry folks, but the positive precondition thePredicates[pos_pre] does not unify with D[pos_pre]!
-		//		return false;
-		//	}
-		//}
-
-		Operator::HPredicate theNumberOfPredicates = Op->GettheNumberOfPredicates();
-
-		// Check the negative preconditions (requires :negative-preconditions in the PDDL Domain)
-		for (Operator::HPredicate neg_pre = Op->GetthePositionOfAddedPreconditions(); neg_pre < theNumberOfPredicates; ++neg_pre)
-		{
-			// Look for this predicate in theCurrentState
-			std::vector<PDDL::HPredicate>* ptr = aStateSortedByPredicates[(StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre))).GettheIdentifier()];
-
-			// Check the situation predicates (with the same identifier than thePredicates[neg_pre]) do not unify with thePredicates[neg_pre]
-			for(std::vector<PDDL::HPredicate>::size_type p = 0; p < ptr->size(); ++p)
-			{
-				if (StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre)).Unify(StateSpaceForwardChaining::GetthePredicate(ptr->operator [](p)), P))
-					// Sorry folks, but the negative precondition thePredicates[neg_pre] does unify with a situation predicate!
-					return false;
-			}
-		}
-
-		// Report each positive precondition predicate successfully unified with a situation predicate in D
-		// and that each negative precondition predicate successfully did not unify with a situation predicate in D
-		return true;
-	}
-#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
-	bool StateSpaceForwardChaining::UnifyPreconditions(const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P, IndexedState& aStateSortedByPredicates) {
-
-		// Check the positive preconditions
-		for (std::vector<std::vector<Operator::Positions>>::size_type par = 0; par < Op->GetthePositionsSize(); ++par)
-		{
-			// Check values from these state predicate parameters are allS equal
-			PDDL::HIdentifier ref = StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, 0).first]).GettheParameter(Op->GetthePosition(par, 0).second);
-			for (std::vector<Operator::Positions>::size_type pos = 1; pos < Op->GetthePositionsSize(par); ++pos)
-			{
-				if (ref != StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, pos).first]).GettheParameter(Op->GetthePosition(par, pos).second))
-					// Sorry folks but this couple of (state) predicate parameters are inconsistent
-					return false;
-			}
-
-			// All the predicate parameters are consistent for this Operator parameter par: give it a final value
-			P[par].second = ref;
-		}
-
-		//// Check the positive preconditions
-		//for (Operator::HPredicate pos_pre = 0; pos_pre < thePositionOfDeletions; ++pos_pre)
-		//{
-		//	if (! (aStateSpaceForwardChaining->GetthePredicate(thePredicates[pos_pre])).Unify(aStateSpaceForwardChaining->GetthePredicate(D[pos_pre]), P))
-		//	{
-		//		// Sorry folks, but the positive precondition thePredicates[pos_pre] does not unify with D[pos_pre]!
-		//		return false;
-		//	}
-		//}
-
-		Operator::HPredicate theNumberOfPredicates = Op->GettheNumberOfPredicates();
-
-		// Check the negative preconditions (requires :negative-preconditions in the PDDL Domain)
-		for (Operator::HPredicate neg_pre = Op->GetthePositionOfAddedPreconditions(); neg_pre < theNumberOfPredicates; ++neg_pre)
-		{
-			// Look for this predicate in theCurrentState
-			std::vector<PDDL::HPredicate>* ptr = aStateSortedByPredicates[(StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre))).GettheIdentifier()];
-
-			// Check the situation predicates (with the same identifier than thePredicates[neg_pre]) do not unify with thePredicates[neg_pre]
-			for(std::vector<PDDL::HPredicate>::size_type p = 0; p < ptr->size(); ++p)
-			{
-				if (StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre)).Match(StateSpaceForwardChaining::GetthePredicate(ptr->operator [](p)), P))
-					// Sorry folks, but the negative precondition thePredicates[neg_pre] does unify with a situation predicate!
-					return false;
-			}
-		}
-
-		// Report each precondition predicate successfully unified with a situation predicate in D
-		// and that each negative precondition predicate successfully did not unify with a situation predicate in D
-		return true;
-	}
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BreadthExpand/0
-//
-bool StateSpaceForwardChaining::BreadthExpand() {
-
-	// Get a reference to the front Plan of theOpen
-	const Plan& aPlan = theOpen.front();
-	// Get a reference to the current state of aPlan
-	const State& aCurrentState = (aPlan.GettheCurrentState())->first;
-
-	// First, Map the predicates of theCurrentState from theIdentifier of these predicates
-	// This begins with memory cleaning
-	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
-	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
-		theStateIndexedByPredicates[i]->clear();
-	// And continue with building the desired mapping
-	for (TemporaryState::size_type i = 0; i < aCurrentState.size(); ++i)
-		theStateIndexedByPredicates[theSharedPredicates[aCurrentState[i]].GettheIdentifier()]->push_back(aCurrentState[i]);
-
-	// Compute children for each possible operator from theDomainOperators
-	for (Domain::HOperator Op = 0; Op < theDomain->GettheNumberOfOperators(); ++Op)
-	{
-		// Get a pointer to the current operator
-		const Operator* aCandidate = theDomain->GettheOperator(Op);
-		Operator::HPredicate NumberOfPositivePreconditions = aCandidate->GettheNumberOfPositivePreconditions();
-		Operator::HArity NumberOfParameters = aCandidate->GettheNumberOfParameters();
-
-		// C indexes all the idenfitiers of a precondition predicate of operator Op together with all their occurences in theStateIndexedByPredicates
-		typedef std::vector<PDDL::HPredicate>* info;
-		// struct info { std::vector<HPredicate>* p; std::vector<HPredicate>::size_type s;};
-#if (STL == MEMORY_ALLOCATION)
-		std::vector<info> C(NumberOfPositivePreconditions);
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-		info* C = (info*) SPHG_ALLOC(sizeof(info) * NumberOfPositivePreconditions);
-#elif (HPHA == MEMORY_ALLOCATION)
-		info* C = (info*) SPHG_ALLOC(sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-#if (SPHG_MEMORY_MAPPING)
-	#if (STL == MEMORY_ALLOCATION)
-			std::vector<info> C(NumberOfPositivePreconditions);
-			of << "{C, vector, " << ", " << R.TimeStamp() << ", " << (sizeof(info) * NumberOfPositivePreconditions) + sizeof(C) << ", " << sizeof(info) << "}," << std::endl;
-	#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			of << "{C, alloc, " << (unsigned long) C << ", " << R.TimeStamp() << ", " << (sizeof(info) * NumberOfPositivePreconditions) << ", " << sizeof(info) << "}," << std::endl;
-	#else
-		#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-		#error MEMORY_ALLOCATION
-	#endif
-#endif
-
-		// Check whether aCandidate is applicable (i.e. is there a precondition which is not a member of theCurrentState?), one precondition predicate at a time
-		bool aCandidate_is_applicable = true;	// Is aCandidate applicable to theCurrentState?
-		for (Operator::HPredicate pre = 0; pre < NumberOfPositivePreconditions; ++pre)
-		{
-			// Look for the predicate identifier of precondition pre in theCurrentState
-			std::vector<PDDL::HPredicate>* ptr = theStateIndexedByPredicates[theSharedPredicates[aCandidate->GetthePredicate(pre)].GettheIdentifier()];
-
-			if (0 == ptr->size())
-			{
-				// This (pointer to) precondition predicate identifier has no match in theCurrentState: aCandidate cannot be applied to theCurrentState
-				aCandidate_is_applicable = false;
-				break;
-			}
-
-			// Remember that this predicate identifier of theCurrentState matches the precondition predicate of precondition pre
-			C[pre] = ptr;
-		}
-
-		//	When aCandidate is not applicable, go to next Op in theDomainOperators
-		if (aCandidate_is_applicable)
-		{
-			// D shall contain a set of predicates from the current situation with the following properties:
-			//	- same number of predicate than the NumberOfPositivePreconditions of aCandidate we try to apply to the current situation
-			//	- each predicate has an identifier which is the same than that of a precondition predicate of Op
-			//	- all predicates are different
-#if (STL == MEMORY_ALLOCATION)
-			Operator::Predicates D(NumberOfPositivePreconditions);
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			PDDL::HPredicate* D = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-#elif (HPHA == MEMORY_ALLOCATION)
-			PDDL::HPredicate* D = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-#if (SPHG_MEMORY_MAPPING)
-	#if (STL == MEMORY_ALLOCATION)
-			of << "{D, vector, " << ", " << R.TimeStamp() << ", " << (sizeof(info) * NumberOfPositivePreconditions) + sizeof(D) << ", " << sizeof(info) << "}," << std::endl;
-	#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			of << "{D, alloc, " << (unsigned long) D << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
-	#else
-		#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-		#error MEMORY_ALLOCATION
-	#endif
-#endif
-
-			// We need to extract predicates from the vectors in C.
-			// To this achieve this extraction, we use an integer number whose digits are stored in P.
-			// Each digit ranges from 0 to the size of a vector in C.
-			// We start with the number (0)(0)...(0)(0), which means we point to the first positions of all the vectors in C.
-			// Then we increase this number by 1 (we begin by increasing the left-most digit)
-			// When a digits reaches the size of its corresponding vector in C, we reset it to 0 and we increase the next digit by 1.
-			// This eventually stops when the last digit reaches the size of its corresponding vector in C; we then try to apply the next Operator.
-#if (STL == MEMORY_ALLOCATION)
-			State P((PDDL::HPredicate) 0 /* Initial Value for each position in P */, NumberOfPositivePreconditions /* Size of P */);
-			Operator::Parameters theParametersOfaCandidate(aCandidate->GettheParameters());
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			PDDL::HPredicate* P = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-			// Begin with pointing to the first positions of the vectors in C
-			memset(P, 0, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-			PDDL::Parameters theParametersOfaCandidate = (PDDL::Parameters) SPHG_ALLOC(NumberOfParameters * sizeof(PDDL::Parameter));
-#elif (HPHA == MEMORY_ALLOCATION)
-			PDDL::HPredicate* P = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-			//of << "{P, alloc, " << (unsigned long) P << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
-			// Begin with pointing to the first positions of the vectors in C
-			memset(P, 0, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-			PDDL::Parameters theParametersOfaCandidate = (PDDL::Parameters) SPHG_ALLOC(NumberOfParameters * sizeof(PDDL::Parameter), sizeof(PDDL::Parameter));
-			//of << "{theParametersOfaCandidate, alloc, " << (unsigned long) theParametersOfaCandidate << ", " << R.TimeStamp() << ", " << NumberOfParameters * sizeof(PDDL::Parameter) << ", " << sizeof(PDDL::Parameter) << "}," << std::endl;
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-			Operator::HPredicate i;	// gets initialized to 0 at each cycle in the loop below
-			do
-			{
-				// Build a bijection from the preconditions of aCandidate to predicates from theCurrentState, based on matching theIdentifiers
-				// D represents this bijection:
-				//	- an index i of D is a precondition number
-				//	- D[i] is a predicate in theCurrenTState
-				// For the unification process to succeed the following condition must hold:
-				//		For all i, j indexes of D, i != j, D[i] != D[j]
-				// That is, we're not going to try to unify to distinct preconditions to the same predicate in theCurrentState
-				for (Operator::HPredicate p = 0; p < NumberOfPositivePreconditions; ++p)
-				{
-					// Get a predicate with identifier C[p] from the current situation
-					PDDL::HPredicate d = C[p]->operator [](P[p]);
-
-					// Check whether this predicate is already in D
-					for (Operator::HPredicate j = 0; j < p; ++j)
-						if (D[j] == d)
-							// IF a predicate is chosen twice THEN go to next set of predicates from theCurrentState
-/********* GOTO *********/	goto NEXT_STATE_PREDICATES;
-
-					// Remember predicate d when it is different from all other predicates already in D
-					D[p] = d;
-				}
-
-				{
-				// All predicates in D are different; try to unify the preconditions of the Operator Op with the predicates in D
-
-					// Unify the preconditions of Op with the predicates in D
-#if (STL == MEMORY_ALLOCATION)
-					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION))
-					aCandidate->CopytheParametersInto(theParametersOfaCandidate);
-					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-					{
-						// Apply theDomainOperators[Op] to theCurrentState and check whether the resulting state is new
-						State aState = StateSpaceForwardChaining::Apply(aCurrentState, aCandidate, D, theParametersOfaCandidate);
-
-						// Make a child plan when the resulting state is new
-						if (theStates.end() == theStates.find(aState))
-						{
-							// Put this new state into theStates data store
-							States::iterator new_state = theStates.insert(std::pair<State, Plan::length_type>(aState, aPlan.Length() + 1)).first;
-
-							// Remember this child plan leading to this new state
-							Operator::HOperatorSignatures anOS( *(aPlan.GettheOperatorSignatures()) );
-							Operator::OperatorSignature tempOS = aCandidate->MaketheOperatorSignature(theParametersOfaCandidate);
-							anOS.push_back(AddOperatorSignature(tempOS));
-
-#if defined(_DEBUG)
-
-							Plan theCurrentChild = Plan(new_state, anOS);
-							std::cout << "The current state is {";
-							for (TemporaryState::size_type i = 0; i < (aPlan.GettheCurrentState())->first.size(); ++i)
-							{
-								Predicate aPredicate = theSharedPredicates[((aPlan.GettheCurrentState()->first)[i])];
-								std::cout << theIdentifiers[aPredicate.GettheIdentifier()] << "(";
-								for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
-								{
-									std::cout << theIdentifiers[aPredicate.GettheParameter(a)];
-									if (a < (aPredicate.GettheArity() - 1))
-										 std::cout << ",";
-								}
-
-								if (i < ((aPlan.GettheCurrentState())->first.size() - 1))
-									std::cout << "), ";
-							}
-							std::cout << ")}." << std::endl << "   Applying operator ";
-
-							Operator::OperatorSignature currentOS = theSharedOperatorSignatures[(theCurrentChild.GettheOperatorSignatures())->back()];
-							std::cout << theIdentifiers[currentOS[currentOS.size() - 1]] << "(";
-							for (Operator::HArity a = 0; a < (currentOS.size() - 1); ++a)
-								if (a == (currentOS.size() - 2))
-									std::cout << theIdentifiers[currentOS[a]];
-								else
-									std::cout << theIdentifiers[currentOS[a]] << ",";
-
-							// Write a ')' at the end of the list of parameters but also when the theOperatorSignature[i].second.size() is 0 (zero)
-							std::cout << ")" << std::endl;
-
-							std::cout << "   The resulting state is {";
-							for (size_t i = 0; i < (theCurrentChild.GettheCurrentState())->first.size(); ++i)
-							{
-								Predicate aPredicate = theSharedPredicates[((theCurrentChild.GettheCurrentState()->first)[i])];
-								std::cout << theIdentifiers[aPredicate.GettheIdentifier()] << "(";
-								for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
-								{
-									std::cout << theIdentifiers[aPredicate.GettheParameter(a)];
-									if (a < (aPredicate.GettheArity() - 1))
-										 std::cout << ",";
-								}
-
-								if (i < ((theCurrentChild.GettheCurrentState())->first.size() - 1))
-									std::cout << "), ";
-							}
-							std::cout << ")}." << std::endl << std::endl;
-#endif	// defined(_DEBUG)
-							// Report immediately when this child plan is a solution
-							if (Included(aState, theFinalState->first))
-							{
-								// Memorize this child plan as the current solution
-								thePlanFound = Plan(new_state, anOS);
-
-#if (STL == MEMORY_ALLOCATION)
-								// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-								SPHG_FREE(theParametersOfaCandidate);
-								SPHG_FREE(D);
-								SPHG_FREE(P);
-								SPHG_FREE(C);
-#elif (HPHA == MEMORY_ALLOCATION)
-								//of << "{theParametersOfaCandidate, free1, " << (unsigned long) theParametersOfaCandidate << ", " << R.TimeStamp() << ", " << NumberOfParameters * sizeof(PDDL::Parameter) << ", " << sizeof(PDDL::Parameter) << "}," << std::endl;
-								SPHG_FREE((PDDL::Parameters) theParametersOfaCandidate, sizeof(PDDL::Parameter) * NumberOfParameters, sizeof(PDDL::Parameter));
-								//of << "{D, free1, " << (unsigned long) D << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
-								SPHG_FREE((PDDL::HPredicate*) D, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-								//of << "{P, free1, " << (unsigned long) P << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
-								SPHG_FREE((PDDL::HPredicate*) P, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-								//of << "{C, free1, " << (unsigned long) C << ", " << R.TimeStamp() << ", " << sizeof(info) * NumberOfPositivePreconditions << ", " << sizeof(info) << "}," << std::endl;
-								SPHG_FREE((info*) C, sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-								// Report this child plan is a solution
-								return true;
-							}
-
-							// This child plan IS NOT a solution; enqueue it so as to BreadthExpand/0 it later
-							theOpen.push_back(Plan(new_state, anOS));
-						}
-					}
-				}
-
-/*** LABEL ***/	NEXT_STATE_PREDICATES:
-				// Increase the number in P, possibly re-setting a digit to 0 when the increase reaches the size of a vector in C
-				i = 0;	// Start with precondition number 0
-				while ((i < NumberOfPositivePreconditions) && ((++P[i]) == C[i]->size()))
-				{
-					P[i] = 0;
-					++i;
-				}
-			}
-			// When the NumberOfPositivePreconditions has been reached, it means that all possible combinations of predicates
-			// from theCurrentState have been generated and tested against the positive preconditions of Op; so it's time to break this loop
-			while (i < NumberOfPositivePreconditions);
-
-#if (STL == MEMORY_ALLOCATION)
-			// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			SPHG_FREE(theParametersOfaCandidate);
-			SPHG_FREE(D);
-			SPHG_FREE(P);
-#elif (HPHA == MEMORY_ALLOCATION)
-			//of << "{theParametersOfaCandidate, free3, " << (unsigned long) theParametersOfaCandidate << ", " << R.TimeStamp() << ", " << NumberOfParameters * sizeof(PDDL::Parameter) << ", " << sizeof(PDDL::Parameter) << "}," << std::endl;
-			SPHG_FREE((PDDL::Parameters) theParametersOfaCandidate, sizeof(PDDL::Parameter) * NumberOfParameters, sizeof(PDDL::Parameter));
-			//of << "{D, free3, " << (unsigned long) D << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
-			SPHG_FREE((PDDL::HPredicate*) D, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-			//of << "{P, free3, " << (unsigned long) P << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
-			SPHG_FREE((PDDL::HPredicate*) P, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-		}
-
-#if (STL == MEMORY_ALLOCATION)
-		// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-		SPHG_FREE(C);
-#elif (HPHA == MEMORY_ALLOCATION)
-		//of << "{C, free4, " << (unsigned long) C << ", " << R.TimeStamp() << ", " << sizeof(info) * NumberOfPositivePreconditions << ", " << sizeof(info) << "}," << std::endl;
-		SPHG_FREE((info*) C, sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-	}
-
-	// Report that no solution has been found during this expansion; maybe next time...
-	return false;
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BreadthFirst/1
-//
-bool StateSpaceForwardChaining::BreadthFirst(bool memory_consumption_is_measured /* default value is false */) {
-
-	IterationNumber theCurrentIteration = 0;		// No iteration in the while loop below, yet (we won't iterate when theInitialState is included in theFinalState
-	size_t s_open = 0;								// theOpen initially is empty
-	s_open_Max = 0;									// Record the maximum memory size of the search
-
-	//s = "memory heat map.txt";
-	//of.open(s.c_str());
-	//of.setf(std::ios_base::fixed, std::ios_base::floatfield);
-	//of.precision(8);
-
-	// Check whether theFinalState is included in theInitialState
-	if (Included(theInitialState->first, theFinalState->first))
-	{
-		// Memorize this empty solution for external access
-		thePlanFound = Plan(theInitialState);
-
-		// Tell the user you did a really good job!
-		return true;
-	}
-	else // TheFinalState IS NOT INCLUDED in the InitialState: this search starts now...
-	{
-		SearchFrontier::iterator theOpen_last;	// used to compute memory size of theOpen
-
-		// Prepare for the ride on the Planning Frontier
-		theOpen.push_back(Plan(theInitialState));
-
-		// When the user wants to know more about the memory consumption, record the movements on theOpen
-		if (memory_consumption_is_measured)
-		{
-			s_open = sizeof(theOpen) + sizeof(theOpen.front());
-			s_open_Max = s_open;
-			theOpen_last = theOpen.begin();
-		}
-
-		// ... and go for it!
-		while (! theOpen.empty())
-		{// StateSpaceForwardChaining as long as there are Plans to expand
-
-			// Compute the children of the first plan appearing in theOpen
-			if (BreadthExpand())
-			{
-				// BreadthExpand/0 memorized the solution child into thePlanFound
-
-				// No need for heavy memory any longer
-				theOpen.clear();
-
-				// Tell the user you did a good job!
-				return true;
-			}
-
-			// When the user wants to know more about the memory consumption, record the movements on theOpen
-			if (memory_consumption_is_measured)
-			{
-				// Point to the first node added to theOpen by BreadthExpand/0
-				++theOpen_last;
-				// But if BreadthExpand/0 added nothing to theOpen then theOpen_last now points to (theOpen.end())...
-				if (theOpen.end() == theOpen_last)
-					// ... so get one node back in theOpen
-					--theOpen_last;
-				else // (theOpen.end() != theOpen_last)
-					// Count the memory usage of the nodes added to theOpen by BreadthExpand/0
-					for(SearchFrontier::iterator it = theOpen_last; it != theOpen.end(); ++it)
-					{
-						s_open += sizeof(*it);
-						// Remember the memory usage of this node (it points to this node) was counted
-						theOpen_last = it;
-					}
-
-				// Record, if necessary, the maximum memory consumption of theOpen
-				if (s_open_Max < s_open) s_open_Max = s_open;
-
-				std::cout << "Search step #" << (++theCurrentIteration) << " (" << INTERNAL_TYPES::u16(theOpen.front().Length()) << "): "
-					<< theOpen.size() << " open plans for " << s_open << " bytes (Maximum total search size is " 
-					<< StateSpaceForwardChaining::SizeOf() << " bytes)." << std::endl;
-
-				// This substraction is in advance of the call to pop_front/0 just below
-				s_open -= sizeof(theOpen.front());
-			}
-
-			// No child-plan is a solution: pop the parent-plan from the search frontier
-			theOpen.pop_front();					
-		}
-
-		// Tell the user the search space became empty before a solution was found
-		return false;
-	}
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::CostExpand/0
-//
-bool StateSpaceForwardChaining::CostExpand() {
-
-	// Get the lowest cost of theOpenWithCosts
-	const PDDL::Number aCost = theOpenWithCosts.top().first;
-	// Get a reference to the lowest cost Plan of theOpenWithCosts
-	const Plan aPlan = theOpenWithCosts.top().second;
-	// Get a reference to the current state of aPlan
-	const State& aCurrentState = (aPlan.GettheCurrentState())->first;
-	// As inserting children plans shall modify the top plan, pop aPlan (i.e. the current top plan) NOW from the search frontier
-	theOpenWithCosts.pop();					
-
-	// First, Map the predicates of theCurrentState from theIdentifier of these predicates
-	// This begins with memory cleaning
-	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
-	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
-		theStateIndexedByPredicates[i]->clear();
-	// And continue with building the desired mapping
-	for (TemporaryState::size_type i = 0; i < aCurrentState.size(); ++i)
-		theStateIndexedByPredicates[theSharedPredicates[aCurrentState[i]].GettheIdentifier()]->push_back(aCurrentState[i]);
-
-	// Compute children for each possible operator from theDomainOperators
-	for (Domain::HOperator Op = 0; Op < theDomain->GettheNumberOfOperators(); ++Op)
-	{
-		// Get a pointer to the current operator
-		const Operator* aCandidate = theDomain->GettheOperator(Op);
-		Operator::HPredicate NumberOfPositivePreconditions = aCandidate->GettheNumberOfPositivePreconditions();
-		Operator::HArity NumberOfParameters = aCandidate->GettheNumberOfParameters();
-
-		// C indexes all the idenfitiers of a precondition predicate of operator Op together with all their occurences in theStateIndexedByPredicates
-		typedef std::vector<PDDL::HPredicate>* info;
-		// struct info { std::vector<HPredicate>* p; std::vector<HPredicate>::size_type s;};
-#if (STL == MEMORY_ALLOCATION)
-		std::vector<info> C(NumberOfPositivePreconditions);
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-		info* C = (info*) SPHG_ALLOC(sizeof(info) * NumberOfPositivePreconditions);
-#elif (HPHA == MEMORY_ALLOCATION)
-		info* C = (info*) SPHG_ALLOC(sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-		// Check whether aCandidate is applicable (i.e. is there a precondition which is not a member of theCurrentState?), one precondition predicate at a time
-		bool aCandidate_is_applicable = true;	// Is aCandidate applicable to theCurrentState?
-		for (Operator::HPredicate pre = 0; pre < NumberOfPositivePreconditions; ++pre)
-		{
-			// Look for the predicate identifier of precondition pre in theCurrentState
-			std::vector<PDDL::HPredicate>* ptr = theStateIndexedByPredicates[theSharedPredicates[aCandidate->GetthePredicate(pre)].GettheIdentifier()];
-
-			if (0 == ptr->size())
-			{
-				// This (pointer to) precondition predicate identifier has no match in theCurrentState: aCandidate cannot be applied to theCurrentState
-				aCandidate_is_applicable = false;
-				break;
-			}
-
-			// Remember that this predicate identifier of theCurrentState matches the precondition predicate of precondition pre
-			C[pre] = ptr;
-		}
-
-		//	When aCandidate is not applicable, go to next Op in theDomainOperators
-		if (aCandidate_is_applicable)
-		{
-			// D shall contain a set of predicates from the current situation with the following properties:
-			//	- same number of predicate than the NumberOfPositivePreconditions of aCandidate we try to apply to the current situation
-			//	- each predicate has an identifier which is the same than that of a precondition predicate of Op
-			//	- all predicates are different
-#if (STL == MEMORY_ALLOCATION)
-			State D(NumberOfPositivePreconditions);
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			PDDL::HPredicate* D = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-#elif (HPHA == MEMORY_ALLOCATION)
-			PDDL::HPredicate* D = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-			// We need to extract predicates from the vectors in C.
-			// To this end, we use an integer number whose digits are stored in P.
-			// Each digit ranges from 0 to the size of a vector in C.
-			// We start with the number (0)(0)...(0)(0), which means we point to the first positions of all the vectors in C.
-			// Then we increase this number by 1 (we begin increasing the left-most digit)
-			// When a digits reaches the size of its corresponding vector in C, we reset it to 0 and we increase the next digit by 1.
-			// Everything stops when the last digit reaches the size of its corresponding vector in C; we then try to apply the next Operator.
-#if (STL == MEMORY_ALLOCATION)
-			State P((PDDL::HPredicate) 0 /* Initial Value for each position in P */, NumberOfPositivePreconditions /* Size of P */);
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			PDDL::HPredicate* P = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-			// Begin with pointing to the first positions of the vectors in C
-			memset(P, 0, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-#elif (HPHA == MEMORY_ALLOCATION)
-			PDDL::HPredicate* P = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-			// Begin with pointing to the first positions of the vectors in C
-			memset(P, 0, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-			Operator::HPredicate i;	// gets initialized to 0 at each cycle in the loop below
-			do
-			{
-				// Build a bijection from the preconditions of aCandidate to predicates from theCurrentState, based on matching theIdentifiers
-				// D represents this bijection:
-				//	- an index i of D is a precondition number
-				//	- D[i] is a predicate in theCurrenTState
-				// For the unification process to succeed the following condition must hold:
-				//		For all i, j indexes of D, i != j, D[i] != D[j]
-				// That is, we're not going to try to unify to distinct preconditions to the same predicate in theCurrentState
-				for (Operator::HPredicate p = 0; p < NumberOfPositivePreconditions; ++p)
-				{
-					// Get a predicate with identifier C[p] from the current situation
-					PDDL::HPredicate d = C[p]->operator [](P[p]);
-
-					// Check whether this predicate is already in D
-					for (Operator::HPredicate j = 0; j < p; ++j)
-						if (D[j] == d)
-							// IF a predicate is chosen twice THEN go to next set of predicates from theCurrentState
-/********* GOTO *********/	goto NEXT_STATE_PREDICATES;
-
-					// Remember predicate d when it is different from all other predicates already in D
-					D[p] = d;
-				}
-
-				{
-				// All predicates in D are different; try to unify the preconditions of the Operator Op with the predicates in D
-
-					// Unify the preconditions of Op with the predicates in D
-#if (STL == MEMORY_ALLOCATION)
-					Operator::Parameters theParametersOfaCandidate(aCandidate->GettheParameters());
-					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-					PDDL::Parameters theParametersOfaCandidate = (PDDL::Parameters) SPHG_ALLOC(NumberOfParameters * sizeof(PDDL::Parameter));
-					aCandidate->CopytheParametersInto(theParametersOfaCandidate);
-					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
-#elif (HPHA == MEMORY_ALLOCATION)
-					PDDL::Parameters theParametersOfaCandidate = (PDDL::Parameters) SPHG_ALLOC(NumberOfParameters * sizeof(PDDL::Parameter), sizeof(PDDL::Parameter));
-					aCandidate->CopytheParametersInto(theParametersOfaCandidate);
-					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-					{
-						State aState = StateSpaceForwardChaining::Apply(aCurrentState, aCandidate, D, theParametersOfaCandidate);
-
-						// Make a child plan when the resulting state is new
-						if (theStates.end() == theStates.find(aState))
-						{
-							// Put this new state into theStates data store
-							States::iterator new_state = theStates.insert(std::pair<State, Plan::length_type>(aState, aPlan.Length() + 1)).first;
-
-							// Remember this child
-							Operator::HOperatorSignatures anOS( *(aPlan.GettheOperatorSignatures()) );
-							Operator::OperatorSignature tempsOS = aCandidate->MaketheOperatorSignature(theParametersOfaCandidate);
-							anOS.push_back(AddOperatorSignature(tempsOS));
-
-#if defined(_DEBUG)
-							Plan theCurrentChild = Plan(new_state, anOS);
-
-							std::cout << std::endl << "The current state is {";
-							for (TemporaryState::size_type i = 0; i < (aPlan.GettheCurrentState())->first.size(); ++i)
-							{
-								Predicate aPredicate = theSharedPredicates[((aPlan.GettheCurrentState()->first)[i])];
-								std::cout << theIdentifiers[aPredicate.GettheIdentifier()] << "(";
-								for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
-								{
-									std::cout << theIdentifiers[aPredicate.GettheParameter(a)];
-									if (a < (aPredicate.GettheArity() - 1))
-										 std::cout << ",";
-								}
-
-								if (i < ((aPlan.GettheCurrentState())->first.size() - 1))
-									std::cout << "), ";
-							}
-							std::cout << ")}." << std::endl 
-								<< "The current cost is " << (aCost) << std::endl 
-								<< "   Applying operator ";
-
-							Operator::OperatorSignature currentOS = theSharedOperatorSignatures[(theCurrentChild.GettheOperatorSignatures())->back()];
-							std::cout << theIdentifiers[currentOS[currentOS.size() - 1]] << "(";
-							for (Operator::HArity a = 0; a < (currentOS.size() - 1); ++a)
-								if (a == (currentOS.size() - 2))
-									std::cout << theIdentifiers[currentOS[a]];
-								else
-									std::cout << theIdentifiers[currentOS[a]] << ",";
-
-							// Write a ')' at the end of the list of parameters but also when the theOperatorSignature[i].second.size() is 0 (zero)
-							std::cout << ")" << std::endl;
-
-							std::cout << "The resulting state is {";
-							for (size_t i = 0; i < (theCurrentChild.GettheCurrentState())->first.size(); ++i)
-							{
-								Predicate aPredicate = theSharedPredicates[((theCurrentChild.GettheCurrentState()->first)[i])];
-								std::cout << theIdentifiers[aPredicate.GettheIdentifier()] << "(";
-								for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
-								{
-									std::cout << theIdentifiers[aPredicate.GettheParameter(a)];
-									if (a < (aPredicate.GettheArity() - 1))
-										 std::cout << ",";
-								}
-
-								if (i < ((theCurrentChild.GettheCurrentState())->first.size() - 1))
-									std::cout << "), ";
-							}
-							std::cout << ")}." << std::endl;
-							std::cout << "The resulting cost is " << (1 + aCost + theDomain->GetNumericCost(Op)) << std::endl;
-#endif	// defined(_DEBUG)
-							// Report immediately when this child is a solution
-							if (Included(aState, theFinalState->first))
-							{
-								thePlanFound = Plan(new_state, anOS);
-								theCostOfthePlanFound = 1 + aCost + theDomain->GetNumericCost(Op);	// 1 operator has been added: Add 1 to the cost of this plan
-
-#if (STL == MEMORY_ALLOCATION)
-								// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-								SPHG_FREE(theParametersOfaCandidate);
-								SPHG_FREE(D);
-								SPHG_FREE(P);
-								SPHG_FREE(C);
-#elif (HPHA == MEMORY_ALLOCATION)
-								SPHG_FREE((PDDL::Parameters) theParametersOfaCandidate, sizeof(PDDL::Parameter) * NumberOfParameters, sizeof(PDDL::Parameter));
-								SPHG_FREE((PDDL::HPredicate*) D, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-								SPHG_FREE((PDDL::HPredicate*) P, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-								SPHG_FREE((info*) C, sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-								// Report this child is a solution
-								return true;
-							}
-
-							// Remember this child plan with its cost in the priority queue
-							theOpenWithCosts.push(PlanWithCost(1 + aCost + theDomain->GetNumericCost(Op), Plan(new_state, anOS)));	// 1 operator has been added: Add 1 to the cost of this plan
-						}
-					}
-
-#if (STL == MEMORY_ALLOCATION)
-				// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-				SPHG_FREE(theParametersOfaCandidate);
-#elif (HPHA == MEMORY_ALLOCATION)
-				SPHG_FREE((PDDL::Parameters) theParametersOfaCandidate, sizeof(PDDL::Parameter) * NumberOfParameters, sizeof(PDDL::Parameter));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-				}
-
-/*** LABEL ***/	NEXT_STATE_PREDICATES:
-				// Increase the number in P, possibly re-setting a digit to 0 when the increase reaches the size of a vector in C
-				i = 0;	// Start with precondition number 0
-				while ((i < NumberOfPositivePreconditions) && ((++P[i]) == C[i]->size()))
-				{
-					P[i] = 0;
-					++i;
-				}
-			}
-			// When the NumberOfPositivePreconditions has been reached, it means that all possible combinations of predicates
-			// from theCurrentState have been generated and tested against the positive preconditions of Op; so it's time to break this loop
-			while (i < NumberOfPositivePreconditions);
-
-#if (STL == MEMORY_ALLOCATION)
-			// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-			SPHG_FREE(D);
-			SPHG_FREE(P);
-#elif (HPHA == MEMORY_ALLOCATION)
-			SPHG_FREE((PDDL::HPredicate*) D, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-			SPHG_FREE((PDDL::HPredicate*) P, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-		}
-
-#if (STL == MEMORY_ALLOCATION)
-		// Nothing to do here: the STL takes care of the memory management for its containers
-#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
-		SPHG_FREE(C);
-#elif (HPHA == MEMORY_ALLOCATION)
-		SPHG_FREE((info*) C, sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-	}
-
-	// Report that no solution has been found during this expansion; maybe next time...
-	return false;
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BestFirst/0
-//
-bool StateSpaceForwardChaining::BestFirst() {
-
-	// Check whether theFinalState is included in theInitialState
-	if (Included(theInitialState->first, theFinalState->first))
-	{
-		// Memorize this empty solution for external access
-		thePlanFound = Plan(theInitialState);
-		theCostOfthePlanFound = 0.0f;
-
-		// Tell the user you did a really good job!
-		return true;
-	}
-	else // TheFinalState IS NOT INCLUDED in the InitialState: this search is really starting now...
-	{
-		// Prepare for the ride on the Planning Frontier
-		theOpenWithCosts.push(PlanWithCost(0.0f, Plan(theInitialState)));
-
-		// ... and go for it!
-		while (! theOpenWithCosts.empty())
-		{// StateSpaceForwardChaining as long as there are Plans to expand
-
-			// Compute the children of the lowest cost plan appearing in theOpenWithCosts
-			if (CostExpand())
-			{
-				// CostExpand/0 memorized the solution child into thePlanFound and its cost into theCostOfthePlanFound
-
-				// No need for heavy memory any longer
-				while (! theOpenWithCosts.empty()) theOpenWithCosts.pop();
-
-				// Tell the user you did a good job!
-				return true;
-			}
-		}
-
-		// Tell the user the search space became empty before a solution was found
-		return false;
-	}
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Put/4
-//
-std::ostream& StateSpaceForwardChaining::Put(std::ostream& o, const Plan* aPlan, const std::string& tab, const IterationNumber aCurrentIteration) const {
-	if (aCurrentIteration > 0)
-	{
-		o << "(Plan #" << aCurrentIteration << "):" << std::endl;
-	}
-	else
-		o << "Solution plan found:" << std::endl;
-
-	// Output the actions in aPlan
-	if (0 == aPlan->Length())
-	{
-		o << tab << "Plan is empty." << std::endl;
-	}
-	else // (0 == aPlan->Length()) but we really mean (0 < aPlan->Length())
-	{
-		const Operator::HOperatorSignatures* theOperatorSignatures = aPlan->GettheOperatorSignatures();
-		for (Operator::HOperatorSignatures::size_type i = 0; i < aPlan->Length(); ++i)
-		{
-			// Compute a pretty printing tab so that actions are aligned on the same column
-			std::string spaces(tab);
-			for(unsigned char ws = 0; ws < (unsigned char)(floor(log10((float) aPlan->Length())) - floor(log10((float) (i + 1)))); ++ws)
-				spaces += " ";
-
-			// 1 action per line:
-			//		action_format	::=	action_identifier "(" parameter-list ")"
-			//		parameter-list	::=	parameter_identifier [ "," parameter-list ]
-			Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
-			o << spaces << (i + 1) << ": " << theIdentifiers[OS[OS.size() - 1]] << "(";
-			for (Operator::HArity a = 0; a < (OS.size() - 1); ++a)
-				if (a == (OS.size() - 2))
-					o << theIdentifiers[OS[a]];
-				else
-					o << theIdentifiers[OS[a]] << ",";
-
-			// Write a ')' at the end of the list of parameters but also when the theOperatorSignatures[i].second.size() is 0 (zero)
-			o << ")" << std::endl;
-		}
-	}
-
-	// Output the state after the application of the last action in aPlan
-	o << "The resulting state is {";
-	for (PDDL::HPredicate i = 0; i < (aPlan->GettheCurrentState())->first.size(); ++i)
-	{
-		Predicate aPredicate = theSharedPredicates[((aPlan->GettheCurrentState()->first)[i])];
-		o << theIdentifiers[aPredicate.GettheIdentifier()] << "(";
-		for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
-		{
-			o << theIdentifiers[aPredicate.GettheParameter(a)];
-			if (a < (aPredicate.GettheArity() - 1))
-				 o << ",";
-		}
-
-		if (i < ((aPlan->GettheCurrentState())->first.size() - 1))
-			o << "), ";
-	}
-	o << ")}." << std::endl;
-
-	return o;
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::SizeOf/0
-//
-size_t StateSpaceForwardChaining::SizeOf() {
-	// Compute the size of the memory for this StateSpaceForwardChaining search
-
-	size_t s_id = sizeof(theIdentifiers);
-	for (std::vector<PDDL::Identifier>::size_type id = 0; id < theIdentifiers.size(); ++id)
-		s_id += sizeof(theIdentifiers[id]);
-
-	size_t s_sp1 = sizeof(theSharedPredicates);
-	for (PDDL::HPredicate sp = 0; sp < theSharedPredicates.size(); ++sp)
-		s_sp1 += theSharedPredicates[sp].SizeOf();
-
-	size_t s_sp2 = sizeof(theStatesPredicates);
-	for (StatePredicates::iterator it = theStatesPredicates.begin(); it != theStatesPredicates.end(); ++it)
-	{
-		Predicate p = it->first;
-		s_sp2 += p.SizeOf() + sizeof(it->second);
-	}
-
-	size_t s_sos = sizeof(theSharedOperatorSignatures);
-	for (Operator::OperatorSignatures::size_type os1 = 0; os1 < theSharedOperatorSignatures.size(); ++os1)
-	{
-		s_sos += sizeof(theSharedOperatorSignatures[os1]);
-		for (size_t os2 = 0; os2 < theSharedOperatorSignatures[os1].size(); ++os2)
-		{
-			s_sos += sizeof(theSharedOperatorSignatures[os1][os2]);
-		}
-	}
-
-	size_t s_sip = sizeof(theStateIndexedByPredicates);
-	for (IndexedState::size_type ip1 = 0; ip1 < theStateIndexedByPredicates.size(); ++ip1)
-	{
-		s_sip += sizeof(theStateIndexedByPredicates[ip1]);
-		// We can't add the size of each indexed state because each search node expansion modify this size
-	}
-
-	size_t s_s = sizeof(theStates);
-	for (States::iterator it = theStates.begin(); it != theStates.end(); ++it)
-	{
-		s_s += sizeof((*it));
-		for (TemporaryState::size_type i = 0; i < (it->first).size(); ++i)
-			s_s += sizeof(it->first[i]);
-	}
-
-	std::cout	<< std::endl
-				<< "Memory consumption for this state space forward chaining search:" << std::endl
-				<< "   - " << theIdentifiers.size() << " identifiers for " << s_id << " bytes." << std::endl
-				<< "   - " << theSharedPredicates.size() << " predicates for " << s_sp1 << " bytes." << std::endl
-				<< "   - " << theStates.size() << " states for " << s_s << " bytes." << std::endl
-				<< "   - " << theSharedOperatorSignatures.size() << " operator signatures for " << s_sos << " bytes." << std::endl;
-
-	return (+ sizeof(theDomain)
-			+ sizeof(theProblem)
-			+ sizeof(theSizeOftheSharedPredicates)
-			+ sizeof(theInitialState)
-			+ sizeof(theFinalState)
-			+ thePlanFound.SizeOf()
-			+ sizeof(theCostOfthePlanFound)
-			+ s_open_Max	// == 0 when (memory_consumption_is_measured == false)
-			+ s_id
-			+ s_sp1
-			+ s_sp2
-			+ s_sos
-			+ s_sip
-			+ s_s
-);
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ConvertthePlanFound/0
-//
-EXTERNAL_TYPES::op_str* StateSpaceForwardChaining::ConvertthePlanFound() const {
-
-	// The linked list which shall contain thePlanFound
-	EXTERNAL_TYPES::op_str* PlanFound = new EXTERNAL_TYPES::op_str;	// op_str default constructor sets arity to 0 (== the linked list contains a solution)
-
-	// Begin with a fake element which contains the plan length, i.e. the number of elements in the linked list
-	PlanFound->arg_name[0] = (char*) thePlanFound.Length();	// Length/0 return a size_t; hopefully, a plan length should be strictly less than 128
-
-	EXTERNAL_TYPES::op_str* p = PlanFound;
-	const Operator::HOperatorSignatures* theOperatorSignatures = thePlanFound.GettheOperatorSignatures();
-	for (Plan::length_type i = 0; i < thePlanFound.Length(); ++i)
-	{
-		// Get some heap space for the next operator in the plan and point to this new store
-		p->op_next = new EXTERNAL_TYPES::op_str;
-		p = p->op_next;
-
-		// Get the internal structure (the OperatorSignature) and convert it to the op_str* linked list
-		Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
-		p->arity = (int) (1 + OS.size());	// theIdentifier of the Operator PLUS theParameters of the Operator
-
-		// Put the Operator identifier in arg_name[0]
-		// First, get some heap space for the string of characters PLUS 1 space for marking the end of the string
-		PDDL::HIdentifier action_identifier = OS[OS.size() - 1];
-		p->arg_name[0] = (char*) malloc(1 + theIdentifiers[action_identifier].size());
-		for (unsigned char c = 0; c < theIdentifiers[action_identifier].size(); ++c)
-			p->arg_name[0][c] = theIdentifiers[action_identifier].c_str()[c];
-		// Mark the end of the string of characters
-		p->arg_name[0][theIdentifiers[action_identifier].size()] = '\0';
-
-		// Put the Operator parameters from arg_name[1] to arg_name[arity - 1]
-		for (Operator::HArity a = 0; (a < MAX_ARGS_OP && a < p->arity); ++a)
-		{
-			// First, get space for the string of characters PLUS 1 space for marking the end of the string
-			p->arg_name[a] = (char*) malloc(1 + theIdentifiers[OS[a]].size());
-			for (unsigned char c = 0; c < theIdentifiers[OS[a]].size(); ++c)
-				p->arg_name[a][c] = theIdentifiers[OS[a]].c_str()[c];
-			// Mark the end of the string of characters
-			p->arg_name[a][theIdentifiers[OS[a]].size()] = '\0';
-		}
-	}
-
-	return PlanFound;
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ConvertthePlanFound/1
-//
-void StateSpaceForwardChaining::ConvertthePlanFound(EXTERNAL_TYPES::plan& aPlan) const {
-
-	const Operator::HOperatorSignatures* theOperatorSignatures = thePlanFound.GettheOperatorSignatures();
-	for (Plan::length_type i = 0; i < thePlanFound.Length(); ++i)
-	{
-		Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
-
-		EXTERNAL_TYPES::op op_i;
-		op_i.first = theIdentifiers[OS[OS.size() - 1]];
-
-		for (Operator::HArity a = 0; a < (OS.size() - 1); ++a)
-			op_i.second.push_back(theIdentifiers[OS[a]]);
-
-		aPlan.push_back(op_i);
-	}
-
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ConvertthePlanFoundToString/0
-//
-std::string StateSpaceForwardChaining::ConvertthePlanFoundToString() const {
-	std::string buffer = "";
-
-	const Operator::HOperatorSignatures* theOperatorSignatures = thePlanFound.GettheOperatorSignatures();
-	for (Plan::length_type i = 0; i < thePlanFound.Length(); ++i)
-	{
-		Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
-
-		buffer += theIdentifiers[OS[OS.size()]];
-		buffer += "(";
-
-		for (Operator::HArity a = 0; a < (OS.size() - 1); ++a)
-		{
-			buffer += theIdentifiers[OS[a]];
-			if (a < (OS.size() - 2))
-				buffer += ",";
-			else // (a >= (OS.size() - 2))
-			{
-				if (i < (thePlanFound.Length() - 1))
-					buffer += ");";
-				else // (i == (thePlanFound.Length() - 1)
-					buffer += ").";
-			}
-		}
-	}
-
-	return buffer;
-}
-
+// ================================================================================================ Beginning of file "StateSpaceForwardChaining.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//	  StateSpaceForwardChaining/2 --- Freezes the problem of the domain, then registers with it
+//	  StateSpaceForwardChaining/2 --- Searches a frozen problem of a domain snapshot, without registering
+//	  StateSpaceForwardChaining/4 --- Constructs various search structures from the domain and the frozen problem
+//	 ~StateSpaceForwardChaining/0 --- Unregisters from the problem and frees the space allocated with theStateIndexedByPredicates
+//						  Reset/0 --- Must be called between two successive searches for the same problem
+//						  Apply/4 --- Make the new state (in place) when all the preconditions have been unified and all parameters are valued
+//		   UnifyPreconditions/4-5 --- Unify each of the positive preconditions of this operator with predicates from the current situation
+//						 Ground/0 --- Instantiate the operators reachable from the initial state into a table of grounded actions
+//	  PrunetheIrrelevantActions/0 --- Keep the grounded actions which may contribute to reaching the goal
+//		     BuildtheSymmetries/1 --- Find the symmetries of the grounded actions with the static predicates
+//					MakethePlan/1 --- Walk up the parents of a search node and build the plan leading to its state
+//				   GettheCostOf/1 --- Sum the costs of the operators of a plan, for the searches counting its length
+//		   MaketheSymmetricPlan/2 --- Replay the plan to a canonical state from the initial state, mapping each action to the action actually applied
+//		   GettheResultingState/1 --- The state actually reached by a plan, replayed with the grounded actions
+//					StartBudget/0 --- Start counting the expansions and the time of a new search
+//					   MustStop/1 --- Is the search cancelled, or is its budget spent? Then make the partial plan
+//		   SizeOftheSearchSpace/0 --- Memory size of the states, nodes and frontiers, checked against the budget
+//			 MakethePartialPlan/0 --- Build the plan to the generated state missing the fewest predicates of the goal
+//			  ApplytheOperators/2 --- Unify the domain operators with a state in every possible way and give each child to a routine
+//				  BreadthExpand/0 --- Apply the domain operators to the state of the front Plan of the search frontier and push back the new plans
+//				AddBreadthChild/4 --- Push back the child of BreadthExpand/0 when its state is new
+//		  GroundedBreadthExpand/0 --- Same as BreadthExpand/0 with the grounded actions
+//			  StartBreadthFirst/0 --- Prepare the search frontier of BreadthFirst/1
+//				   BreadthFirst/1 --- Expands the shallowest plan in the state space first
+//					 CostExpand/0 --- Apply the domain operators to the state of the lowest cost Plan of the search frontier and push the new plans with updated costs
+//				   AddCostChild/4 --- Push the child of CostExpand/0 with its cost when its state is new
+//			 GroundedCostExpand/0 --- Same as CostExpand/0 with the grounded actions
+//				 StartBestFirst/0 --- Prepare the search frontier of BestFirst/0
+//					  BestFirst/0 --- Expands the least cost plan in the state space first
+//					AStarExpand/1 --- Test the lowest estimated cost node of the search frontier for the goal, then push its children with their estimates
+//					 StartAStar/1 --- Estimate the initial state and prepare the search frontier of AStar/1
+//						  AStar/1 --- Expands the plan with the least cost plus estimate first; the first plan expanded to the goal is optimal
+//				   GreedyExpand/1 --- Evaluate the state of a node of either search frontier and push its children with this estimate
+//		   StartGreedyBestFirst/1 --- Prepare the search frontiers of GreedyBestFirst/1
+//				GreedyBestFirst/1 --- Expands the plan with the least estimate first, alternating with the plans ending with preferred actions
+//		 ExpandtheStartedSearch/0 --- Expand one node of the search prepared by StartBreadthFirst/0, StartBestFirst/0, StartAStar/1 or StartGreedyBestFirst/1
+//						   Step/1 --- Expand at most some nodes of the started search, then return
+//						 RunFor/1 --- Expand the nodes of the started search for some time, then return
+//						 Replan/2 --- Repair the previous plan after some predicates of the initial state were added or deleted
+//						 Repair/2 --- Replay the previous plan from the new initial state, or search for its states
+//			  MaketheSuccessors/2 --- Apply the domain operators (or the grounded actions) to a state and keep all the children
+//				   AddSuccessor/4 --- Keep a child of MaketheSuccessors/2
+//					 DepthFirst/2 --- Expands the last state of the current path within the current bound, recursively
+//			 IterativeDeepening/1 --- Repeats depth first searches with increasing bounds on the cost plus estimate of the plans
+//		   IndextheForwardState/1 --- Index a state of the forward search by each of its predicates
+//					MeetForward/1 --- Look for the backward nodes satisfied by the state of a forward node
+//				   MeetBackward/1 --- Look for the states of the forward search satisfying a backward node
+//				   ForwardLayer/0 --- Expand all the forward nodes of the current depth
+//				  BackwardLayer/0 --- Regress all the backward nodes of the current depth through the grounded actions
+//		MaketheBidirectionalPlan/0 --- Join the forward plan and the backward plan where the searches met
+//				  Bidirectional/0 --- Breadth first search forward from the initial state and backward from the goal, until they meet
+//		 ExpandthePartOftheLayer/1 --- Expand a range of the nodes of the current layer into the children buffer of a thread
+//		   ParallelBreadthFirst/1 --- Expand each layer of a breadth first search with several threads, then merge their children in order
+//		  HashDistributedReceive/3 --- Register a state sent to its owner thread and open it when its plan is cheaper
+//			 HashDistributedSend/2 --- Deliver the batches of children of a thread to their owners
+//		   HashDistributedExpand/2 --- Receive, expand and send states until all the threads are idle
+//			HashDistributedAStar/1 --- Cost-optimal search by several threads, each owning the states of some hash values
+//		 HashDistributedMustStop/2 --- Is the search cancelled, or is its budget spent by the threads?
+//	  MaketheHashDistributedPlan/4 --- Walk up the parents of a state from thread to thread, then replay the plan
+//							Put/4 --- Writing (a plan + its resulting state) to an ostream
+//						 SizeOf/0 --- Computes the memory used by this search
+//			ConvertthePlanFound/0 --- Consert (the plan found by the search) to the user's desired type
+//			ConvertthePlanFound/1 --- Consert (the plan found by the search) to the some STL structure
+//	ConvertthePlanFoundToString/0 --- Putting the actions and parameters identifiers into an std::string
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::reverse
+#include <iostream>						// Visibility for std::cout, std::endl
+#include <limits>						// Visibility for std::numeric_limits
+#include <map>							// Accessing the table of string constants for this search
+#include <math.h>						// Visibility for floor/1 and log10/1
+#include <thread>						// Visibility for std::thread
+#include <valarray>						// (when (STL == MEMORY_ALLOCATION)) Visibility for std::valarray
+
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"		// Visibility for MEMORY_ALLOCATION, STL, HPHA, CLASSIC
+#endif
+
+// The fixed number of slots of the transposition table of IterativeDeepening/1; 0 disables the table
+#define SPHG_TRANSPOSITION_TABLE_SLOTS		4096
+
+// The least number of nodes of a layer a thread of ParallelBreadthFirst/1 expands; smaller layers use fewer threads
+#define SPHG_PARALLEL_BREADTH_MINIMUM_NODES		64
+
+// The number of expansions after which a thread of HashDistributedAStar/1 sends its batches of children
+#define SPHG_HDA_EXPANSIONS_PER_SEND			16
+
+// The number of expansions between two readings of the clock and of the memory of a search with a budget
+#define SPHG_BUDGET_CHECK_PERIOD				256
+
+#ifndef _SPHG_PLANNER_OPERATOR_H
+	#include "Operator.h"
+#endif
+
+#ifndef _SPHG_PLANNER_PREDICATE_H
+	#include "Predicate.h"
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"	// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const INTERNAL_TYPES::u32 StateSpaceForwardChaining::NO_WORKER;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StateSpaceForwardChaining/2
+//
+StateSpaceForwardChaining::StateSpaceForwardChaining(Domain& aDomain, Domain::HProblem aProblem) : StateSpaceForwardChaining(aDomain, aProblem, DomainSnapshot::Freeze(aDomain, aProblem), aDomain.GettheProblem(aProblem)) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StateSpaceForwardChaining/2
+//
+StateSpaceForwardChaining::StateSpaceForwardChaining(const DomainSnapshot& aSnapshot, Domain::HProblem aProblem) : StateSpaceForwardChaining(aSnapshot.GettheDomain(), aProblem, aSnapshot.GettheFrozenProblem(aProblem), 0) {}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StateSpaceForwardChaining/4
+//
+// aFrozenProblem is passed by value, and its identifiers and predicates are swapped into this search:
+// the problem frozen by StateSpaceForwardChaining/2 is then never copied, and a frozen problem of a
+// DomainSnapshot is copied once.
+//
+StateSpaceForwardChaining::StateSpaceForwardChaining(const Domain& aDomain, Domain::HProblem aProblem, DomainSnapshot::FrozenProblem aFrozenProblem, Problem* aRegistration) : theRegistration(aRegistration), theCostOfthePlanFound(0.0f), theBestEstimate(0.0f), theRegularPriority(0), thePreferredPriority(0), theBound(0.0f), theNextBound(0.0f), theTranspositionTable(0), theForwardMeeting(SearchNode::NO_NODE), theBackwardMeeting(SearchNode::NO_NODE), theSizeOftheWorkers(0), theCancellation(0), theStatus(SEARCH_COMPLETED), theExpansions(0), theNextBudgetCheck(0), theCostOfthePartialPlan(0.0f), theMissingGoals(0), theStartedSearch(NO_STARTED_SEARCH), theStartedHeuristic(0), theExpandedNode(SearchNode::NO_NODE), theExpandedState(0), theExpandedSuccessors(0), theActionsAreGrounded(false), theIrrelevantActions(0), theIrrelevantPredicates(0), theStubbornSetsAreUsed(true), theSymmetriesAreUsed(true), theStatesArePacked(true), theStatesAreCompressed(false) {
+	// Set the pointers which hold necessary data for this search
+	theDomain = &aDomain;
+	theProblem = aProblem;
+
+	// Build the table of string constants for this search
+	theIdentifiers.swap(aFrozenProblem.theIdentifiers);
+
+	// Get the table of shared predicates for this search: the shared predicates from theDomain, then from theProblem
+	theSharedPredicates.swap(aFrozenProblem.thePredicates);
+
+	// Remember the current number of shared predicates in order to ease future searches
+	theSizeOftheSharedPredicates = (PDDL::HPredicate) theSharedPredicates.size();
+
+	// Set the initial and final state of the problem for this search
+	State anInitialState(Convert(aFrozenProblem.thePositiveInitialState));
+	theFinalState = Convert(aFrozenProblem.thePositiveGoalState);
+
+	// Build theStatePredicates from theInitialState and theFinalState
+	for (State::index_type i = anInitialState.first(); i < State::end(); i = anInitialState.next(i))
+		theStatesPredicates[theSharedPredicates[i]] = (PDDL::HPredicate) i;
+	for (State::index_type i = theFinalState.first(); i < State::end(); i = theFinalState.next(i))
+		theStatesPredicates[theSharedPredicates[i]] = (PDDL::HPredicate) i;
+
+	// The predicates of theInitialState with an identifier that no operator adds or deletes are true in all the states:
+	// they are checked once (cf. Ground/0 and the index below) and removed from the states and from theFinalState
+	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
+	std::vector<bool> theChangedIdentifiers(s, false);
+	for (Domain::HOperator Op = 0; Op < theDomain->GettheNumberOfOperators(); ++Op)
+	{
+		const Operator* aCandidate = theDomain->GettheOperator(Op);
+		for (Operator::HPredicate eff = aCandidate->GetthePositionOfDeletedPreconditions(); eff < aCandidate->GetthePositionOfNegativePreconditions(); ++eff)
+			theChangedIdentifiers[theSharedPredicates[aCandidate->GetthePredicate(eff)].GettheIdentifier()] = true;
+	}
+	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
+		if (theChangedIdentifiers[i])
+			theDynamicIdentifiers.push_back(i);
+	for (State::index_type i = anInitialState.first(); i < State::end(); i = anInitialState.next(i))
+		if (! theChangedIdentifiers[theSharedPredicates[i].GettheIdentifier()])
+			theStaticPredicates.insert((PDDL::HPredicate) i);
+	anInitialState.remove(theStaticPredicates);
+	theFinalState.remove(theStaticPredicates);
+	theInitialState = theStates.Insert(anInitialState).first;
+
+	// Finally, register this search for aProblem, unless it searches a DomainSnapshot
+	if (0 != theRegistration)
+		theRegistration->Register(this);
+
+	// One more thing... Initialize map from the predicate identifiers to the predicates in the current state, where the static predicates stay
+	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
+		theStateIndexedByPredicates.push_back(new std::vector<PDDL::HPredicate>);
+	for (State::index_type i = theStaticPredicates.first(); i < State::end(); i = theStaticPredicates.next(i))
+		theStateIndexedByPredicates[theSharedPredicates[i].GettheIdentifier()]->push_back((PDDL::HPredicate) i);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::~StateSpaceForwardChaining/0
+//
+StateSpaceForwardChaining::~StateSpaceForwardChaining() {
+	// This search no longer exists for theProblem
+	if (0 != theRegistration)
+		theRegistration->Unregister(this);
+
+	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
+	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
+		delete theStateIndexedByPredicates[i];
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Reset/0
+//
+void StateSpaceForwardChaining::Reset() {
+	// Reset the table of shared predicates for this search
+	theSharedPredicates.resize(theSizeOftheSharedPredicates);
+
+	// Reset the initial state of the problem for this search (theFinalState is not stored in theStates):
+	//	1. Copy the initial state of the problem out of theStates
+	const State anInitialState(theStates.GettheState(theInitialState));
+	//	2. Make theStates fresh with theInitialState of the problem
+	theStates.Clear();
+	theInitialState = theStates.Insert(anInitialState).first;
+
+	// Forget the nodes of the previous search
+	theNodes.clear();
+	theBestCosts.clear();
+	theEstimates.clear();
+	while (! theOpenWithEstimates.empty()) theOpenWithEstimates.pop();
+	while (! theOpenWithCosts.empty()) theOpenWithCosts.pop();
+	while (! thePreferredOpenWithCosts.empty()) thePreferredOpenWithCosts.pop();
+	theExpandedStates.clear();
+	theSuccessors.clear();
+	thePath.clear();
+	theChoices.clear();
+	theEndOfthePath.clear();
+	theBackwardNodes.clear();
+	theBackwardOpen.clear();
+	theBackwardRequired.Clear();
+	theBackwardNodesByRequired.clear();
+	theBackwardNodesByPredicate.clear();
+	theForwardNodes.clear();
+	theForwardStatesByPredicate.clear();
+	theForwardMeeting = SearchNode::NO_NODE;
+	theBackwardMeeting = SearchNode::NO_NODE;
+	theBreadthWorkers.clear();
+	theExpansionsPerThread.clear();
+	theSizeOftheWorkers = 0;
+	theStatus = SEARCH_COMPLETED;
+	theExpansions = 0;
+	thePartialPlan = Plan();
+	theCostOfthePartialPlan = 0.0f;
+	theMissingGoals = 0;
+	theStartedSearch = NO_STARTED_SEARCH;
+	theStartedHeuristic = 0;
+
+	// Build theStatePredicates from theInitialState and theFinalState
+	theStatesPredicates.clear();
+	for (State::index_type i = anInitialState.first(); i < State::end(); i = anInitialState.next(i))
+		theStatesPredicates[theSharedPredicates[i]] = (PDDL::HPredicate) i;
+	for (State::index_type i = theFinalState.first(); i < State::end(); i = theFinalState.next(i))
+		theStatesPredicates[theSharedPredicates[i]] = (PDDL::HPredicate) i;
+	for (State::index_type i = theStaticPredicates.first(); i < State::end(); i = theStaticPredicates.next(i))
+		theStatesPredicates[theSharedPredicates[i]] = (PDDL::HPredicate) i;
+	// And from the predicates reached by Ground/0, if any
+	for (State::index_type i = theReachablePredicates.first(); i < State::end(); i = theReachablePredicates.next(i))
+		theStatesPredicates.insert(StateSpaceForwardChaining::StatePredicates::value_type(theSharedPredicates[i], (PDDL::HPredicate) i));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Apply/4
+//
+#if (STL == MEMORY_ALLOCATION)
+	void StateSpaceForwardChaining::Apply(State& aState, const Operator* Op, Operator::Predicates& D, PDDL::Parameters P) {
+
+		Operator::HPredicate thePositionOfDeletedPreconditions = Op->GetthePositionOfDeletedPreconditions();
+		Operator::HPredicate thePositionOfDeletions = Op->GetthePositionOfDeletions();
+		Operator::HPredicate thePositionOfAdditions = Op->GetthePositionOfAdditions();
+		Operator::HPredicate thePositionOfNegativePreconditions = Op->GetthePositionOfNegativePreconditions();
+
+		State theDeletions;		// The mask of the predicates deleted from aState
+		State theAdditions;		// The mask of the predicates added to aState
+
+		// The deleted preconditions are the predicates of D in this range
+		for (Operator::HPredicate del_pre = thePositionOfDeletedPreconditions; del_pre < thePositionOfDeletions; ++del_pre)
+			theDeletions.insert(D[del_pre]);
+
+		for (Operator::HPredicate del = thePositionOfDeletions; del < thePositionOfAdditions; ++del)
+		{
+			// In this range, all the predicates only belong to the delete list.
+			// Get the position of this deleted predicate in theStatesPredicates and add this position to theDeletions
+			// (after the predicate parameters have been updated with the instantiated parameters of this Operator);
+			// a predicate which is not in theStatesPredicates cannot be in aState
+			StateSpaceForwardChaining::StatePredicates::const_iterator it = StateSpaceForwardChaining::Find( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(del)).UpdatetheParameters(P));
+			if (StateSpaceForwardChaining::Found(it))
+			{
+				theDeletions.insert(it->second);
+			}
+		}
+
+		for (Operator::HPredicate add = thePositionOfAdditions; add < thePositionOfNegativePreconditions; ++add)
+		{
+			// In this range, all the predicates only belong to the add list.
+			// Get the position of anAddedPredicate in theStatesPredicates and add this position to theAdditions
+			// (after the predicate parameters have been updated with the instantiated parameters of this Operator)
+			theAdditions.insert( StateSpaceForwardChaining::InsertAsSharedPredicate( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(add)).UpdatetheParameters(P)));
+		}
+
+		// Deletions first, additions last: aState = (aState AND NOT theDeletions) OR theAdditions
+		aState.remove(theDeletions);
+		aState.add(theAdditions);
+	}
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+	void StateSpaceForwardChaining::Apply(State& aState, const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P) {
+
+		Operator::HPredicate thePositionOfDeletedPreconditions = Op->GetthePositionOfDeletedPreconditions();
+		Operator::HPredicate thePositionOfDeletions = Op->GetthePositionOfDeletions();
+		Operator::HPredicate thePositionOfAdditions = Op->GetthePositionOfAdditions();
+		Operator::HPredicate thePositionOfNegativePreconditions = Op->GetthePositionOfNegativePreconditions();
+
+		State theDeletions;		// The mask of the predicates deleted from aState
+		State theAdditions;		// The mask of the predicates added to aState
+
+		// The deleted preconditions are the predicates of D in this range
+		for (Operator::HPredicate del_pre = thePositionOfDeletedPreconditions; del_pre < thePositionOfDeletions; ++del_pre)
+			theDeletions.insert(D[del_pre]);
+
+		for (Operator::HPredicate del = thePositionOfDeletions; del < thePositionOfAdditions; ++del)
+		{
+			// In this range, all the predicates only belong to the delete list.
+			// Get the position of this deleted predicate in theStatesPredicates and add this position to theDeletions
+			// (after the predicate parameters have been updated with the instantiated parameters of this Operator);
+			// a predicate which is not in theStatesPredicates cannot be in aState
+			StateSpaceForwardChaining::StatePredicates::const_iterator it = StateSpaceForwardChaining::Find( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(del)).UpdatetheParameters(P));
+			if (StateSpaceForwardChaining::Found(it))
+			{
+				theDeletions.insert(it->second);
+			}
+		}
+
+		for (Operator::HPredicate add = thePositionOfAdditions; add < thePositionOfNegativePreconditions; ++add)
+		{
+			// In this range, all the predicates only belong to the add list.
+			// Get the position of anAddedPredicate in theStatesPredicates and add this position to theAdditions
+			// (after the predicate parameters have been updated with the instantiated parameters of this Operator)
+			theAdditions.insert( StateSpaceForwardChaining::InsertAsSharedPredicate( StateSpaceForwardChaining::MakeCopyOfthePredicate(Op->GetthePredicate(add)).UpdatetheParameters(P)));
+		}
+
+		// Deletions first, additions last: aState = (aState AND NOT theDeletions) OR theAdditions
+		aState.remove(theDeletions);
+		aState.add(theAdditions);
+	}
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::UnifyPreconditions/4-5
+//
+#if (STL == MEMORY_ALLOCATION)
+	bool StateSpaceForwardChaining::UnifyPreconditions(const Operator* Op, Operator::Predicates& D, PDDL::Parameters P, IndexedState& aStateSortedByPredicates) {
+
+		// Check the positive preconditions
+		for (std::vector<std::vector<Operator::Positions>>::size_type par = 0; par < Op->GetthePositionsSize(); ++par)
+		{ 
+			// Check values from these state predicate parameters are all be equal
+			PDDL::HIdentifier ref = StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, 0).first]).GettheParameter(Op->GetthePosition(par, 0).second);
+			for (std::vector<Operator::Positions>::size_type pos = 1; pos < Op->GetthePositionsSize(par); ++pos)
+			{
+				if (ref != StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, pos).first]).GettheParameter(Op->GetthePosition(par,pos).second))
+					// Sorry folks but this couple of (state) predicate parameters are inconsistent
+					return false;
+			}
+
+			// All the predicate parameters are consistent for this Operator parameter par: give it a final value
+			P[par].first = PDDL::STRING_VALUE;	// Might be a useful information for debugging purposes
+			P[par].second = ref;
+		}
+
+		//// Check the positive preconditions
+		//for (Operator::HPredicate pos_pre = 0; pos_pre < thePositionOfDeletions; ++pos_pre)
+		//{
+		//	if (! (aStateSpaceForwardChaining->GetthePredicate(thePredicates[pos_pre])).Unify(aStateSpaceForwardChaining->GetthePredicate(D[pos_pre]), P))
+		//	{
+		//		 Sorry folks, but the positive precondition thePredicates[pos_pre] does not unify with D[pos_pre]!
+		//		return false;
+		//	}
+		//}
+
+		Operator::HPredicate theNumberOfPredicates = Op->GettheNumberOfPredicates();
+
+		// Check the negative preconditions (requires :negative-preconditions in the PDDL Domain)
+		for (Operator::HPredicate neg_pre = Op->GetthePositionOfAddedPreconditions(); neg_pre < theNumberOfPredicates; ++neg_pre)
+		{
+			// Look for this predicate in theCurrentState
+			std::vector<PDDL::HPredicate>* ptr = aStateSortedByPredicates[(StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre))).GettheIdentifier()];
+
+			// Check the situation predicates (with the same identifier than thePredicates[neg_pre]) do not unify with thePredicates[neg_pre]
+			for(std::vector<PDDL::HPredicate>::size_type p = 0; p < ptr->size(); ++p)
+			{
+				if (StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre)).Unify(StateSpaceForwardChaining::GetthePredicate(ptr->operator [](p)), P))
+					// Sorry folks, but the negative precondition thePredicates[neg_pre] does unify with a situation predicate!
+					return false;
+			}
+		}
+
+		// Report each positive precondition predicate successfully unified with a situation predicate in D
+		// and that each negative precondition predicate successfully did not unify with a situation predicate in D
+		return true;
+	}
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+	bool StateSpaceForwardChaining::UnifyPreconditions(const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P, IndexedState& aStateSortedByPredicates) {
+
+		// Check the positive preconditions
+		for (std::vector<std::vector<Operator::Positions>>::size_type par = 0; par < Op->GetthePositionsSize(); ++par)
+		{
+			// Check values from these state predicate parameters are allS equal
+			PDDL::HIdentifier ref = StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, 0).first]).GettheParameter(Op->GetthePosition(par, 0).second);
+			for (std::vector<Operator::Positions>::size_type pos = 1; pos < Op->GetthePositionsSize(par); ++pos)
+			{
+				if (ref != StateSpaceForwardChaining::GetthePredicate(D[Op->GetthePosition(par, pos).first]).GettheParameter(Op->GetthePosition(par, pos).second))
+					// Sorry folks but this couple of (state) predicate parameters are inconsistent
+					return false;
+			}
+
+			// All the predicate parameters are consistent for this Operator parameter par: give it a final value
+			P[par].second = ref;
+		}
+
+		//// Check the positive preconditions
+		//for (Operator::HPredicate pos_pre = 0; pos_pre < thePositionOfDeletions; ++pos_pre)
+		//{
+		//	if (! (aStateSpaceForwardChaining->GetthePredicate(thePredicates[pos_pre])).Unify(aStateSpaceForwardChaining->GetthePredicate(D[pos_pre]), P))
+		//	{
+		//		// Sorry folks, but the positive precondition thePredicates[pos_pre] does not unify with D[pos_pre]!
+		//		return false;
+		//	}
+		//}
+
+		Operator::HPredicate theNumberOfPredicates = Op->GettheNumberOfPredicates();
+
+		// Check the negative preconditions (requires :negative-preconditions in the PDDL Domain)
+		for (Operator::HPredicate neg_pre = Op->GetthePositionOfAddedPreconditions(); neg_pre < theNumberOfPredicates; ++neg_pre)
+		{
+			// Look for this predicate in theCurrentState
+			std::vector<PDDL::HPredicate>* ptr = aStateSortedByPredicates[(StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre))).GettheIdentifier()];
+
+			// Check the situation predicates (with the same identifier than thePredicates[neg_pre]) do not unify with thePredicates[neg_pre]
+			for(std::vector<PDDL::HPredicate>::size_type p = 0; p < ptr->size(); ++p)
+			{
+				if (StateSpaceForwardChaining::GetthePredicate(Op->GetthePredicate(neg_pre)).Match(StateSpaceForwardChaining::GetthePredicate(ptr->operator [](p)), P))
+					// Sorry folks, but the negative precondition thePredicates[neg_pre] does unify with a situation predicate!
+					return false;
+			}
+		}
+
+		// Report each precondition predicate successfully unified with a situation predicate in D
+		// and that each negative precondition predicate successfully did not unify with a situation predicate in D
+		return true;
+	}
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Ground/0
+//
+// A relaxed reachability analysis, where deletions and negative preconditions are ignored: starting
+// from the predicates of theInitialState, the positive preconditions of each operator of theDomain
+// are unified with all the predicates reached so far (exactly as BreadthExpand/0 unifies them with the
+// predicates of a state) and the additions of each new instance are reached in turn, until no new
+// predicate is reached. An operator instance which is never built this way cannot apply to any state
+// of the search.
+//
+// The instances of an operator are then ordered as BreadthExpand/0 tries them (P is a number whose
+// left-most digit increases first, over predicates sorted in increasing order) so that a search with
+// theGroundedActions generates the same children in the same order than a search with theDomain operators.
+//
+bool StateSpaceForwardChaining::Ground() {
+
+	// An instance of an operator: the operator and the predicates of D, the last precondition first
+	typedef std::pair<Domain::HOperator, std::vector<PDDL::HPredicate> > Instance;
+	std::map<Instance, std::vector<PDDL::Parameter> > theInstances;	// Each instance with the values of the parameters of its operator
+
+	// The negative preconditions are ignored: they are unified with the predicates of a state with no predicate
+	Predicate::PredicatesStore::size_type s = theDomain->GetthePredicatesStoreSize();
+	std::vector<std::vector<PDDL::HPredicate> > theEmptyVectors(s);
+	IndexedState theEmptyState;
+	for (Predicate::PredicatesStore::size_type i = 0; i < s; ++i)
+		theEmptyState.push_back(&theEmptyVectors[i]);
+
+	theReachablePredicates = theStates.GettheState(theInitialState);
+	bool aNewPredicateWasReached = true;
+	while (aNewPredicateWasReached)
+	{
+		aNewPredicateWasReached = false;
+
+		// Map the predicates reached so far from theIdentifier of these predicates (cf. BreadthExpand/0)
+		for (std::vector<Predicate::PredicatesStore::size_type>::size_type i = 0; i < theDynamicIdentifiers.size(); ++i)
+			theStateIndexedByPredicates[theDynamicIdentifiers[i]]->clear();
+		for (State::index_type i = theReachablePredicates.first(); i < State::end(); i = theReachablePredicates.next(i))
+			theStateIndexedByPredicates[theSharedPredicates[i].GettheIdentifier()]->push_back((PDDL::HPredicate) i);
+
+		for (Domain::HOperator Op = 0; Op < theDomain->GettheNumberOfOperators(); ++Op)
+		{
+			const Operator* aCandidate = theDomain->GettheOperator(Op);
+			Operator::HPredicate NumberOfPositivePreconditions = aCandidate->GettheNumberOfPositivePreconditions();
+			Operator::HArity NumberOfParameters = aCandidate->GettheNumberOfParameters();
+
+			// C indexes, for each precondition, the reached predicates with the same identifier
+			std::vector<std::vector<PDDL::HPredicate>*> C(NumberOfPositivePreconditions);
+			bool aCandidate_is_applicable = true;
+			for (Operator::HPredicate pre = 0; pre < NumberOfPositivePreconditions; ++pre)
+			{
+				C[pre] = theStateIndexedByPredicates[theSharedPredicates[aCandidate->GetthePredicate(pre)].GettheIdentifier()];
+				if (0 == C[pre]->size())
+				{
+					aCandidate_is_applicable = false;
+					break;
+				}
+			}
+
+			if (! aCandidate_is_applicable)
+				continue;
+
+#if (STL == MEMORY_ALLOCATION)
+			Operator::Predicates D(NumberOfPositivePreconditions);
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+			std::vector<PDDL::HPredicate> theD(1 + NumberOfPositivePreconditions);	// 1 more so that theD[0] exists when there is no positive precondition
+			PDDL::HPredicate* D = &theD[0];
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+			// Enumerate the predicates of D with the number P (cf. BreadthExpand/0), but try the right-most digit first:
+			// when the predicates D[p], ..., D[NumberOfPositivePreconditions - 1] are not consistent, all the numbers
+			// which only differ from P on the digits 0 to (p - 1) are skipped at once
+			std::vector<std::vector<PDDL::HPredicate>::size_type> P(NumberOfPositivePreconditions, 0);
+
+			// Where the parameters of aCandidate appear in each precondition (cf. UnifyPreconditions/4)
+			std::vector<std::vector<std::pair<Predicate::HArity, Operator::HArity> > > thePositions(NumberOfPositivePreconditions);
+			for (std::vector<std::vector<Operator::Positions>>::size_type par = 0; par < aCandidate->GetthePositionsSize(); ++par)
+				for (std::vector<Operator::Positions>::size_type pos = 0; pos < aCandidate->GetthePositionsSize(par); ++pos)
+					thePositions[aCandidate->GetthePosition(par, pos).first].push_back(std::pair<Predicate::HArity, Operator::HArity>(aCandidate->GetthePosition(par, pos).second, (Operator::HArity) par));
+			std::vector<PDDL::HIdentifier> theBoundValues(1 + NumberOfParameters);	// 1 more so that theBoundValues[0] exists when there is no parameter
+			std::vector<bool> theBoundParameters(1 + NumberOfParameters);
+
+			Operator::HPredicate i;	// gets initialized at each cycle in the loop below
+			do
+			{
+				theBoundParameters.assign(theBoundParameters.size(), false);
+				for (i = NumberOfPositivePreconditions; i > 0; --i)
+				{
+					Operator::HPredicate p = i - 1;
+					PDDL::HPredicate d = C[p]->operator [](P[p]);
+					for (Operator::HPredicate j = p + 1; j < NumberOfPositivePreconditions; ++j)
+						if (D[j] == d)
+/********* GOTO *********/	goto NEXT_CONSISTENT_PREDICATES;
+
+					for (std::vector<std::pair<Predicate::HArity, Operator::HArity> >::size_type pos = 0; pos < thePositions[p].size(); ++pos)
+					{
+						PDDL::HIdentifier v = theSharedPredicates[d].GettheParameter(thePositions[p][pos].first);
+						Operator::HArity par = thePositions[p][pos].second;
+						if (! theBoundParameters[par])
+						{
+							theBoundParameters[par] = true;
+							theBoundValues[par] = v;
+						}
+						else if (theBoundValues[par] != v)
+/********* GOTO *********/	goto NEXT_CONSISTENT_PREDICATES;
+					}
+
+					D[p] = d;
+				}
+
+				{
+					// Is this instance of aCandidate already known?
+					Instance anInstance(Op, std::vector<PDDL::HPredicate>(NumberOfPositivePreconditions));
+					for (Operator::HPredicate p = 0; p < NumberOfPositivePreconditions; ++p)
+						anInstance.second[NumberOfPositivePreconditions - 1 - p] = D[p];
+					if (theInstances.end() != theInstances.find(anInstance))
+/********* GOTO *********/	goto NEXT_REACHED_PREDICATES;
+
+#if (STL == MEMORY_ALLOCATION)
+					Operator::Parameters theValues(aCandidate->GettheParameters());
+					PDDL::Parameters theParametersOfaCandidate = theValues;
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+					std::vector<PDDL::Parameter> theValues(1 + NumberOfParameters);		// 1 more so that theValues[0] exists when there is no parameter
+					PDDL::Parameters theParametersOfaCandidate = &theValues[0];
+					aCandidate->CopytheParametersInto(theParametersOfaCandidate);
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theEmptyState))
+					{
+						// Reach the additions of this new instance
+						for (Operator::HPredicate add = aCandidate->GetthePositionOfAdditions(); add < aCandidate->GetthePositionOfNegativePreconditions(); ++add)
+						{
+							Predicate anAddition(StateSpaceForwardChaining::MakeCopyOfthePredicate(aCandidate->GetthePredicate(add)).UpdatetheParameters(theParametersOfaCandidate));
+							if ((! StateSpaceForwardChaining::Found(StateSpaceForwardChaining::Find(anAddition))) && (theSharedPredicates.size() >= MAXIMUM_NUMBER_OF_PREDICATES))
+							{
+								// Sorry folks, but there are more than MAXIMUM_NUMBER_OF_PREDICATES reachable predicates: forget about this grounding
+								theReachablePredicates.clear();
+								StateSpaceForwardChaining::Reset();
+								return false;
+							}
+
+							PDDL::HPredicate a = StateSpaceForwardChaining::InsertAsSharedPredicate(anAddition);
+							if (! theReachablePredicates.find(a))
+							{
+								theReachablePredicates.insert(a);
+								aNewPredicateWasReached = true;
+							}
+						}
+
+						theInstances[anInstance] = theValues;
+					}
+				}
+
+/*** LABEL ***/	NEXT_REACHED_PREDICATES:
+				i = 1;	// All the predicates of D are consistent: start with precondition number 0
+/*** LABEL ***/	NEXT_CONSISTENT_PREDICATES:
+				// D[i - 1], ..., D[NumberOfPositivePreconditions - 1] are not consistent: increase the number in P from digit (i - 1)
+				for (Operator::HPredicate j = 0; j < (i - 1); ++j)
+					P[j] = 0;
+				--i;
+				while ((i < NumberOfPositivePreconditions) && ((++P[i]) == C[i]->size()))
+				{
+					P[i] = 0;
+					++i;
+				}
+			}
+			while (i < NumberOfPositivePreconditions);
+		}
+	}
+
+	// Build theGroundedActions, now that all the reachable predicates are known
+	theGroundedActions.clear();
+	for (std::map<Instance, std::vector<PDDL::Parameter> >::iterator it = theInstances.begin(); it != theInstances.end(); ++it)
+	{
+		Domain::HOperator Op = it->first.first;
+		const Operator* aCandidate = theDomain->GettheOperator(Op);
+		const std::vector<PDDL::HPredicate>& D = it->first.second;	// The last precondition first
+		Operator::HPredicate NumberOfPositivePreconditions = aCandidate->GettheNumberOfPositivePreconditions();
+#if (STL == MEMORY_ALLOCATION)
+		PDDL::Parameters theParametersOfaCandidate = it->second;
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+		PDDL::Parameters theParametersOfaCandidate = &(it->second[0]);
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+		Operator::OperatorSignature anOS = aCandidate->MaketheOperatorSignature(theParametersOfaCandidate);
+		GroundedAction anAction(Op, AddOperatorSignature(anOS), theDomain->GetNumericCost(Op));
+
+		// The static predicates of D were checked by the unification, once and for all
+		for (Operator::HPredicate pre = 0; pre < NumberOfPositivePreconditions; ++pre)
+			if (! theStaticPredicates.find(D[pre]))
+				anAction.AddPrecondition(D[pre]);
+
+		for (Operator::HPredicate del_pre = aCandidate->GetthePositionOfDeletedPreconditions(); del_pre < aCandidate->GetthePositionOfDeletions(); ++del_pre)
+			anAction.AddDeletion(D[NumberOfPositivePreconditions - 1 - del_pre]);
+
+		// As in Apply/4, a deletion which is not in theStatesPredicates cannot be in a state
+		for (Operator::HPredicate del = aCandidate->GetthePositionOfDeletions(); del < aCandidate->GetthePositionOfAdditions(); ++del)
+		{
+			StateSpaceForwardChaining::StatePredicates::const_iterator f = StateSpaceForwardChaining::Find(StateSpaceForwardChaining::MakeCopyOfthePredicate(aCandidate->GetthePredicate(del)).UpdatetheParameters(theParametersOfaCandidate));
+			if (StateSpaceForwardChaining::Found(f))
+				anAction.AddDeletion(f->second);
+		}
+
+		for (Operator::HPredicate add = aCandidate->GetthePositionOfAdditions(); add < aCandidate->GetthePositionOfNegativePreconditions(); ++add)
+			anAction.AddAddition(StateSpaceForwardChaining::InsertAsSharedPredicate(StateSpaceForwardChaining::MakeCopyOfthePredicate(aCandidate->GetthePredicate(add)).UpdatetheParameters(theParametersOfaCandidate)));
+
+		// As in UnifyPreconditions/4, a negative precondition forbids all the reachable predicates equal to it; an action forbidding a static predicate is never applicable
+		bool anActionIsApplicable = true;
+		for (Operator::HPredicate neg_pre = aCandidate->GetthePositionOfAddedPreconditions(); neg_pre < aCandidate->GettheNumberOfPredicates(); ++neg_pre)
+		{
+			Predicate aNegativePrecondition(StateSpaceForwardChaining::MakeCopyOfthePredicate(aCandidate->GetthePredicate(neg_pre)).UpdatetheParameters(theParametersOfaCandidate));
+			for (State::index_type p = theReachablePredicates.first(); p < State::end(); p = theReachablePredicates.next(p))
+				if (!(aNegativePrecondition < theSharedPredicates[p]) && !(theSharedPredicates[p] < aNegativePrecondition))
+					anAction.AddNegativePrecondition((PDDL::HPredicate) p);
+			for (State::index_type p = theStaticPredicates.first(); p < State::end(); p = theStaticPredicates.next(p))
+				if (!(aNegativePrecondition < theSharedPredicates[p]) && !(theSharedPredicates[p] < aNegativePrecondition))
+					anActionIsApplicable = false;
+		}
+
+		if (anActionIsApplicable)
+			theGroundedActions.push_back(anAction);
+	}
+
+	// The mutex groups are found before the pruning: the states already in theStates, reached with the operators of theDomain, are packed too
+	theMutexGroups.Build(theGroundedActions, theStates.GettheState(theInitialState));
+	theStates.Pack((theStatesArePacked && theMutexGroups.IsCompact()) ? &theMutexGroups : 0);
+
+	// Only the relevant and applicable grounded actions shall be visited by GroundedBreadthExpand/0 and GroundedCostExpand/0
+	StateSpaceForwardChaining::PrunetheIrrelevantActions();
+	theActionsBySignature.assign(theSharedOperatorSignatures.size(), (GroundedAction::HAction) GroundedAction::NO_ACTION);
+	for (GroundedAction::HAction a = 0; a < theGroundedActions.size(); ++a)
+		theActionsBySignature[theGroundedActions[a].GettheOperatorSignature()] = a;
+	theSuccessorGenerator.Build(theGroundedActions);
+	theStubbornSets.Build(theGroundedActions, theFinalState);
+	StateSpaceForwardChaining::BuildtheSymmetries(theStates.GettheState(theInitialState));
+
+	// The predicates reached by the grounding must survive Reset/0
+	theSizeOftheSharedPredicates = (PDDL::HPredicate) theSharedPredicates.size();
+	theActionsAreGrounded = true;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::PrunetheIrrelevantActions/0
+//
+// Ground/0 is the forward pass: it only builds the actions reachable from theInitialState, ignoring
+// the deletions. This is the backward pass, from theFinalState: a predicate is relevant when it is in
+// theFinalState or a precondition of a relevant action, and forbidden when it is a negative
+// precondition of a relevant action; an action is relevant when it adds a relevant predicate or
+// deletes (without adding it again) a forbidden one. Removing the other actions from a plan leaves a
+// plan, as cheap or cheaper: the searches stay complete, and the cost-optimal searches optimal.
+//
+// The actions kept are in the same order. They may still change some irrelevant predicates, which
+// then stay in the states, so that the state reached by a plan is the one printed.
+//
+void StateSpaceForwardChaining::PrunetheIrrelevantActions() {
+	State someRelevantPredicates(theFinalState);
+	State someForbiddenPredicates;
+	std::vector<bool> theRelevantActions(theGroundedActions.size(), false);
+
+	bool aNewActionIsRelevant = true;
+	while (aNewActionIsRelevant)
+	{
+		aNewActionIsRelevant = false;
+		for (GroundedAction::HAction a = 0; a < theGroundedActions.size(); ++a)
+			if (! theRelevantActions[a])
+			{
+				const GroundedAction& anAction = theGroundedActions[a];
+				State someDeletions(anAction.GettheDeletions());
+				someDeletions.remove(anAction.GettheAdditions());
+				if (anAction.GettheAdditions().intersects(someRelevantPredicates) || someDeletions.intersects(someForbiddenPredicates))
+				{
+					theRelevantActions[a] = true;
+					someRelevantPredicates.add(anAction.GetthePreconditions());
+					someForbiddenPredicates.add(anAction.GettheNegativePreconditions());
+					aNewActionIsRelevant = true;
+				}
+			}
+	}
+
+	// Keep the relevant actions, in the same order
+	GroundedActions::size_type k = 0;
+	for (GroundedAction::HAction a = 0; a < theGroundedActions.size(); ++a)
+		if (theRelevantActions[a])
+			theGroundedActions[k++] = theGroundedActions[a];
+	theIrrelevantActions = (GroundedAction::HAction) (theGroundedActions.size() - k);
+	theGroundedActions.erase(theGroundedActions.begin() + k, theGroundedActions.end());
+
+	State someIrrelevantPredicates(theReachablePredicates);
+	someIrrelevantPredicates.remove(someRelevantPredicates);
+	someIrrelevantPredicates.remove(someForbiddenPredicates);
+	theIrrelevantPredicates = (State::index_type) someIrrelevantPredicates.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BuildtheSymmetries/1
+//
+// The static predicates are not in the states but they still tell objects apart (e.g. the roads
+// between places): theSymmetries are found with them.
+//
+void StateSpaceForwardChaining::BuildtheSymmetries(const State& anInitialState) {
+	State someReachablePredicates(theReachablePredicates);
+	someReachablePredicates.add(theStaticPredicates);
+	State aState(anInitialState);
+	aState.add(theStaticPredicates);
+
+	theSymmetries.Build(theGroundedActions, theSharedOperatorSignatures, theSharedPredicates, someReachablePredicates, aState, theFinalState);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MakethePlan/1
+//
+Plan StateSpaceForwardChaining::MakethePlan(SearchNode::HNode aNode) {
+	// Collect the operator signatures from aNode up to (but excluding) the root node...
+	Operator::HOperatorSignatures anOS;
+	for (SearchNode::HNode n = aNode; SearchNode::NO_NODE != theNodes[n].GettheParent(); n = theNodes[n].GettheParent())
+		anOS.push_back(theNodes[n].GettheOperatorSignature());
+
+	// ... and put them back in the order they were applied
+	std::reverse(anOS.begin(), anOS.end());
+
+	if (theSymmetriesAreUsed && !theSymmetries.Empty())
+		return StateSpaceForwardChaining::MaketheSymmetricPlan(aNode, anOS);
+
+	return Plan(theNodes[aNode].GettheState(), anOS);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::GettheCostOf/1
+//
+// The breadth first searches expand the plans by length: the cost of the plan found is computed as
+// CostExpand/0 computes it, 1 plus the numeric cost of each of its operators, found by the name
+// which ends its operator signature.
+//
+PDDL::Number StateSpaceForwardChaining::GettheCostOf(const Plan& aPlan) const {
+	const Operator::HOperatorSignatures& someOperatorSignatures = *aPlan.GettheOperatorSignatures();
+	PDDL::Number aCost = 0.0f;
+	for (Operator::HOperatorSignatures::size_type o = 0; o < someOperatorSignatures.size(); ++o)
+	{
+		const Operator::OperatorSignature& anOperatorSignature = theSharedOperatorSignatures[someOperatorSignatures[o]];
+		Domain::HOperator Op = 0;
+		while (theDomain->GettheOperator(Op)->GettheIdentifier() != anOperatorSignature[anOperatorSignature.size() - 1])
+			++Op;
+		aCost += 1 + theDomain->GetNumericCost(Op);	// 1 operator has been added: Add 1 to the cost of this plan
+	}
+
+	return aCost;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MaketheSymmetricPlan/2
+//
+// The searches keep the representative of the orbit of each child (cf. Canonicalize/1): an action of
+// the plan to aNode applies to the representative of the state of its parent, which is the image of
+// the state actually reached by some permutation. Along the replay from the root, this permutation is
+// composed with the generators which canonicalized each child (Symmetries::Canonicalize/2 finds them
+// again on the same state), and maps each action to the action actually applied. The state of a node
+// which was not canonicalized (e.g. the root) changes nothing.
+// The plan keeps the canonical state of aNode: the state actually reached is not put in theStates,
+// where it would be a duplicate of its representative (cf. GettheResultingState/1).
+//
+Plan StateSpaceForwardChaining::MaketheSymmetricPlan(SearchNode::HNode aNode, Operator::HOperatorSignatures& someOperatorSignatures) {
+	std::vector<SearchNode::HNode> somePath;
+	for (SearchNode::HNode n = aNode; SearchNode::NO_NODE != n; n = theNodes[n].GettheParent())
+		somePath.push_back(n);
+	std::reverse(somePath.begin(), somePath.end());
+
+	Symmetries::Permutation aPermutation(Symmetries::Identity((GroundedAction::HAction) theGroundedActions.size()));	// From the representatives to the states actually reached
+	std::vector<Symmetries::HGenerator> someGenerators;
+	State aCanonicalState(theStates.GettheState(theNodes[somePath[0]].GettheState()));
+	for (std::vector<SearchNode::HNode>::size_type n = 1; n < somePath.size(); ++n)
+	{
+		const GroundedAction::HAction a = StateSpaceForwardChaining::GettheAction(someOperatorSignatures[n - 1]);
+		const GroundedAction& anAction = theGroundedActions[aPermutation.theActions[a]];
+		theGroundedActions[a].Apply(aCanonicalState);
+		someOperatorSignatures[n - 1] = anAction.GettheOperatorSignature();
+
+		if (aCanonicalState != theStates.GettheState(theNodes[somePath[n]].GettheState()))
+		{
+			someGenerators.clear();
+			theSymmetries.Canonicalize(aCanonicalState, &someGenerators);
+			for (std::vector<Symmetries::HGenerator>::size_type g = 0; g < someGenerators.size(); ++g)
+				theSymmetries.Compose(aPermutation, someGenerators[g]);
+		}
+	}
+
+	return Plan(theNodes[aNode].GettheState(), someOperatorSignatures);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::GettheResultingState/1
+//
+// A plan found with theSymmetries keeps the canonical state it reached (cf. MaketheSymmetricPlan/2),
+// and a repaired plan the state where the repair stopped (cf. Repair/2): the state actually reached
+// is the one of the replay of its grounded actions from theInitialState. A plan made from thePath
+// has no state in theStates (cf. IterativeDeepening/1): it reaches theEndOfthePath
+//
+State StateSpaceForwardChaining::GettheResultingState(const Plan* aPlan) const {
+	if (StateRegistry::NO_STATE == aPlan->GettheCurrentState())
+		return theEndOfthePath;
+
+	const State aState(theStates.GettheState(aPlan->GettheCurrentState()));
+	if (!theActionsAreGrounded)
+		return aState;
+
+	State aReplayedState(theStates.GettheState(theInitialState));
+	const Operator::HOperatorSignatures* someOperatorSignatures = aPlan->GettheOperatorSignatures();
+	for (Operator::HOperatorSignatures::size_type i = 0; i < someOperatorSignatures->size(); ++i)
+	{
+		const GroundedAction::HAction a = StateSpaceForwardChaining::GettheAction((*someOperatorSignatures)[i]);
+		if ((GroundedAction::NO_ACTION == a) || !theGroundedActions[a].IsApplicableTo(aReplayedState))
+			return aState;
+		theGroundedActions[a].Apply(aReplayedState);
+	}
+
+	return aReplayedState;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StartBudget/0
+//
+void StateSpaceForwardChaining::StartBudget() {
+	theStatus = SEARCH_COMPLETED;
+	theExpansions = 0;
+	theNextBudgetCheck = 0;
+	theStartTime = std::chrono::steady_clock::now();
+
+	// Until some state is closer to the goal
+	thePartialPlan = Plan(theInitialState);
+	theCostOfthePartialPlan = 0.0f;
+	State someMissingGoals(theFinalState);
+	someMissingGoals.remove(theStates.GettheState(theInitialState));
+	theMissingGoals = (State::index_type) someMissingGoals.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MustStop/1
+//
+// Called by the searches before they expand someExpansions nodes. Once it has returned true, it keeps
+// returning true until the next search, so that the recursion of DepthFirst/2 unwinds at once.
+// theStatus is SEARCH_COMPLETED, or SEARCH_IN_PROGRESS for a started search, until then.
+//
+bool StateSpaceForwardChaining::MustStop(INTERNAL_TYPES::u32 someExpansions /* default value is 1 */) {
+	if ((SEARCH_COMPLETED != theStatus) && (SEARCH_IN_PROGRESS != theStatus))
+		return true;
+
+	if (IsCancelled())
+	{
+		theStatus = SEARCH_CANCELLED;
+		return true;
+	}
+
+	// Never expand more nodes than theBudget allows...
+	bool theBudgetIsSpent = ((0 != theBudget.theExpansions) && (theBudget.theExpansions - theExpansions < someExpansions));
+	if (! theBudgetIsSpent)
+		theExpansions += someExpansions;
+
+	// ... but read the clock and measure the memory only now and then, as it costs much more than an expansion
+	if (!theBudgetIsSpent && (theNextBudgetCheck <= theExpansions) && ((0 != theBudget.theMicroseconds) || (0 != theBudget.theBytes)))
+	{
+		theNextBudgetCheck = theExpansions + SPHG_BUDGET_CHECK_PERIOD;
+		theBudgetIsSpent = ((0 != theBudget.theMicroseconds) && (theBudget.theMicroseconds <= (INTERNAL_TYPES::u64) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - theStartTime).count()))
+						|| ((0 != theBudget.theBytes) && (theBudget.theBytes <= StateSpaceForwardChaining::SizeOftheSearchSpace()));
+	}
+
+	if (! theBudgetIsSpent)
+		return false;
+
+	theStatus = SEARCH_BUDGET_EXHAUSTED;
+	StateSpaceForwardChaining::MakethePartialPlan();
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::SizeOftheSearchSpace/0
+//
+size_t StateSpaceForwardChaining::SizeOftheSearchSpace() const {
+	size_t s = theStates.SizeOf() + theNodes.capacity() * sizeof(SearchNode)
+			 + theOpen.size() * sizeof(SearchNode::HNode) + (theOpenWithCosts.size() + thePreferredOpenWithCosts.size()) * sizeof(NodeWithCost)
+			 + theOpenWithEstimates.size() * sizeof(NodeWithEstimate) + (theBestCosts.capacity() + theEstimates.capacity()) * sizeof(PDDL::Number)
+			 + theExpandedStates.capacity() / 8 + theForwardNodes.capacity() * sizeof(SearchNode::HNode)
+			 + theBackwardNodes.capacity() * sizeof(BackwardNode) + theBackwardOpen.size() * sizeof(SearchNode::HNode) + theBackwardRequired.SizeOf();
+
+	for (std::vector<const State*>::size_type d = 0; (d < thePath.size()) && (d < theSuccessors.size()); ++d)
+		s += theSuccessors[d].capacity() * sizeof(Successor);
+	for (std::vector< std::vector<StateRegistry::HState> >::size_type p = 0; p < theForwardStatesByPredicate.size(); ++p)
+		s += theForwardStatesByPredicate[p].capacity() * sizeof(StateRegistry::HState);
+
+	return s;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MakethePartialPlan/0
+//
+// The goal-count of a state is the number of predicates of theFinalState it misses; ties are broken
+// with the cheapest plan. IterativeDeepening/1 only keeps the states of thePath, the other searches
+// keep all the nodes they generated.
+//
+void StateSpaceForwardChaining::MakethePartialPlan() {
+	State someMissingGoals;
+
+	if (! thePath.empty())
+	{
+		std::vector<const State*>::size_type aBestDepth = 0;
+		PDDL::Number aCost = 0.0f;
+		for (std::vector<const State*>::size_type d = 0; d < thePath.size(); ++d)
+		{
+			if (0 < d)
+				aCost += theSuccessors[d - 1][theChoices[d - 1]].theCost;
+
+			someMissingGoals = theFinalState;
+			someMissingGoals.remove(*thePath[d]);
+			if (someMissingGoals.size() < theMissingGoals)
+			{
+				theMissingGoals = (State::index_type) someMissingGoals.size();
+				theCostOfthePartialPlan = aCost;
+				aBestDepth = d;
+			}
+		}
+		if (0 == aBestDepth)
+			return;
+
+		Operator::HOperatorSignatures someOperatorSignatures;
+		for (std::vector<const State*>::size_type d = 0; d < aBestDepth; ++d)
+		{
+			Operator::OperatorSignature anOS(theSuccessors[d][theChoices[d]].theOperatorSignature);
+			someOperatorSignatures.push_back(AddOperatorSignature(anOS));
+		}
+		theEndOfthePath = *thePath[aBestDepth];
+		thePartialPlan = Plan(StateRegistry::NO_STATE, someOperatorSignatures);
+	}
+	else if (! theNodes.empty())
+	{
+		SearchNode::HNode aBestNode = 0;
+		someMissingGoals = theFinalState;
+		someMissingGoals.remove(theStates.GettheState(theNodes[0].GettheState()));
+		theMissingGoals = (State::index_type) someMissingGoals.size();
+		for (SearchNode::HNode n = 1; n < theNodes.size(); ++n)
+		{
+			someMissingGoals = theFinalState;
+			someMissingGoals.remove(theStates.GettheState(theNodes[n].GettheState()));
+			if ((someMissingGoals.size() < theMissingGoals) || ((someMissingGoals.size() == theMissingGoals) && (theNodes[n].GettheCost() < theNodes[aBestNode].GettheCost())))
+			{
+				theMissingGoals = (State::index_type) someMissingGoals.size();
+				aBestNode = n;
+			}
+		}
+
+		thePartialPlan = StateSpaceForwardChaining::MakethePlan(aBestNode);
+		theCostOfthePartialPlan = theNodes[aBestNode].GettheCost();
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ApplytheOperators/2
+//
+// Each domain operator is unified in every possible way with the predicates of aState, and each
+// resulting state is given to aChild with the operator and the values of its parameters:
+// BreadthExpand/0, CostExpand/0 and MaketheSuccessors/2 only differ by what they do with the children.
+// aChild returns true to stop the expansion, e.g. when a child is a solution.
+//
+bool StateSpaceForwardChaining::ApplytheOperators(const State& aState, LiftedChild aChild) {
+
+	// First, Map the predicates of aState from theIdentifier of these predicates
+	// This begins with memory cleaning, but for the static predicates which always are in the map
+	for (std::vector<Predicate::PredicatesStore::size_type>::size_type i = 0; i < theDynamicIdentifiers.size(); ++i)
+		theStateIndexedByPredicates[theDynamicIdentifiers[i]]->clear();
+	// And continue with building the desired mapping
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+		theStateIndexedByPredicates[theSharedPredicates[i].GettheIdentifier()]->push_back((PDDL::HPredicate) i);
+
+	// Compute children for each possible operator from theDomainOperators
+	for (Domain::HOperator Op = 0; Op < theDomain->GettheNumberOfOperators(); ++Op)
+	{
+		// Get a pointer to the current operator
+		const Operator* aCandidate = theDomain->GettheOperator(Op);
+		Operator::HPredicate NumberOfPositivePreconditions = aCandidate->GettheNumberOfPositivePreconditions();
+
+		// C indexes all the idenfitiers of a precondition predicate of operator Op together with all their occurences in theStateIndexedByPredicates
+		typedef std::vector<PDDL::HPredicate>* info;
+		// struct info { std::vector<HPredicate>* p; std::vector<HPredicate>::size_type s;};
+#if (STL == MEMORY_ALLOCATION)
+		std::vector<info> C(NumberOfPositivePreconditions);
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+		info* C = (info*) SPHG_ALLOC(sizeof(info) * NumberOfPositivePreconditions);
+#elif (HPHA == MEMORY_ALLOCATION)
+		info* C = (info*) SPHG_ALLOC(sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+#if (SPHG_MEMORY_MAPPING)
+	#if (STL == MEMORY_ALLOCATION)
+			std::vector<info> C(NumberOfPositivePreconditions);
+			of << "{C, vector, " << ", " << R.TimeStamp() << ", " << (sizeof(info) * NumberOfPositivePreconditions) + sizeof(C) << ", " << sizeof(info) << "}," << std::endl;
+	#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+			of << "{C, alloc, " << (unsigned long) C << ", " << R.TimeStamp() << ", " << (sizeof(info) * NumberOfPositivePreconditions) << ", " << sizeof(info) << "}," << std::endl;
+	#else
+		#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+		#error MEMORY_ALLOCATION
+	#endif
+#endif
+
+		// Check whether aCandidate is applicable (i.e. is there a precondition which is not a member of aState?), one precondition predicate at a time
+		bool aCandidate_is_applicable = true;	// Is aCandidate applicable to aState?
+		for (Operator::HPredicate pre = 0; pre < NumberOfPositivePreconditions; ++pre)
+		{
+			// Look for the predicate identifier of precondition pre in aState
+			std::vector<PDDL::HPredicate>* ptr = theStateIndexedByPredicates[theSharedPredicates[aCandidate->GetthePredicate(pre)].GettheIdentifier()];
+
+			if (0 == ptr->size())
+			{
+				// This (pointer to) precondition predicate identifier has no match in aState: aCandidate cannot be applied to aState
+				aCandidate_is_applicable = false;
+				break;
+			}
+
+			// Remember that this predicate identifier of aState matches the precondition predicate of precondition pre
+			C[pre] = ptr;
+		}
+
+		//	When aCandidate is not applicable, go to next Op in theDomainOperators
+		if (aCandidate_is_applicable)
+		{
+			// D shall contain a set of predicates from the current situation with the following properties:
+			//	- same number of predicate than the NumberOfPositivePreconditions of aCandidate we try to apply to the current situation
+			//	- each predicate has an identifier which is the same than that of a precondition predicate of Op
+			//	- all predicates are different
+#if (STL == MEMORY_ALLOCATION)
+			Operator::Predicates D(NumberOfPositivePreconditions);
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+			PDDL::HPredicate* D = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
+#elif (HPHA == MEMORY_ALLOCATION)
+			PDDL::HPredicate* D = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+#if (SPHG_MEMORY_MAPPING)
+	#if (STL == MEMORY_ALLOCATION)
+			of << "{D, vector, " << ", " << R.TimeStamp() << ", " << (sizeof(info) * NumberOfPositivePreconditions) + sizeof(D) << ", " << sizeof(info) << "}," << std::endl;
+	#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+			of << "{D, alloc, " << (unsigned long) D << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
+	#else
+		#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+		#error MEMORY_ALLOCATION
+	#endif
+#endif
+
+			// We need to extract predicates from the vectors in C.
+			// To this achieve this extraction, we use an integer number whose digits are stored in P.
+			// Each digit ranges from 0 to the size of a vector in C.
+			// We start with the number (0)(0)...(0)(0), which means we point to the first positions of all the vectors in C.
+			// Then we increase this number by 1 (we begin by increasing the left-most digit)
+			// When a digits reaches the size of its corresponding vector in C, we reset it to 0 and we increase the next digit by 1.
+			// This eventually stops when the last digit reaches the size of its corresponding vector in C; we then try to apply the next Operator.
+#if (STL == MEMORY_ALLOCATION)
+			std::valarray<PDDL::HPredicate> P((PDDL::HPredicate) 0 /* Initial Value for each position in P */, NumberOfPositivePreconditions /* Size of P */);
+			Operator::Parameters theParametersOfaCandidate(aCandidate->GettheParameters());
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+			PDDL::HPredicate* P = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
+			// Begin with pointing to the first positions of the vectors in C
+			memset(P, 0, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
+			PDDL::Parameters theParametersOfaCandidate = (PDDL::Parameters) SPHG_ALLOC(aCandidate->GettheNumberOfParameters() * sizeof(PDDL::Parameter));
+#elif (HPHA == MEMORY_ALLOCATION)
+			PDDL::HPredicate* P = (PDDL::HPredicate*) SPHG_ALLOC(sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
+			//of << "{P, alloc, " << (unsigned long) P << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
+			// Begin with pointing to the first positions of the vectors in C
+			memset(P, 0, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions);
+			PDDL::Parameters theParametersOfaCandidate = (PDDL::Parameters) SPHG_ALLOC(aCandidate->GettheNumberOfParameters() * sizeof(PDDL::Parameter), sizeof(PDDL::Parameter));
+			//of << "{theParametersOfaCandidate, alloc, " << (unsigned long) theParametersOfaCandidate << ", " << R.TimeStamp() << ", " << aCandidate->GettheNumberOfParameters() * sizeof(PDDL::Parameter) << ", " << sizeof(PDDL::Parameter) << "}," << std::endl;
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+			Operator::HPredicate i;	// gets initialized to 0 at each cycle in the loop below
+			do
+			{
+				// Build a bijection from the preconditions of aCandidate to predicates from aState, based on matching theIdentifiers
+				// D represents this bijection:
+				//	- an index i of D is a precondition number
+				//	- D[i] is a predicate in aState
+				// For the unification process to succeed the following condition must hold:
+				//		For all i, j indexes of D, i != j, D[i] != D[j]
+				// That is, we're not going to try to unify to distinct preconditions to the same predicate in aState
+				for (Operator::HPredicate p = 0; p < NumberOfPositivePreconditions; ++p)
+				{
+					// Get a predicate with identifier C[p] from the current situation
+					PDDL::HPredicate d = C[p]->operator [](P[p]);
+
+					// Check whether this predicate is already in D
+					for (Operator::HPredicate j = 0; j < p; ++j)
+						if (D[j] == d)
+							// IF a predicate is chosen twice THEN go to next set of predicates from aState
+/********* GOTO *********/	goto NEXT_STATE_PREDICATES;
+
+					// Remember predicate d when it is different from all other predicates already in D
+					D[p] = d;
+				}
+
+				{
+				// All predicates in D are different; try to unify the preconditions of the Operator Op with the predicates in D
+
+					// Unify the preconditions of Op with the predicates in D
+#if (STL == MEMORY_ALLOCATION)
+					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION))
+					aCandidate->CopytheParametersInto(theParametersOfaCandidate);
+					if (UnifyPreconditions(aCandidate, D, theParametersOfaCandidate, theStateIndexedByPredicates))
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+					{
+						// Apply theDomainOperators[Op] to (a copy of) aState and give the resulting state to aChild
+						State aResultingState(aState);
+						StateSpaceForwardChaining::Apply(aResultingState, aCandidate, D, theParametersOfaCandidate);
+						if ((this->*aChild)(aCandidate, Op, theParametersOfaCandidate, aResultingState))
+						{
+#if (STL == MEMORY_ALLOCATION)
+							// Nothing to do here: the STL takes care of the memory management for its containers
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+							SPHG_FREE(theParametersOfaCandidate);
+							SPHG_FREE(D);
+							SPHG_FREE(P);
+							SPHG_FREE(C);
+#elif (HPHA == MEMORY_ALLOCATION)
+							SPHG_FREE((PDDL::Parameters) theParametersOfaCandidate, sizeof(PDDL::Parameter) * aCandidate->GettheNumberOfParameters(), sizeof(PDDL::Parameter));
+							SPHG_FREE((PDDL::HPredicate*) D, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
+							SPHG_FREE((PDDL::HPredicate*) P, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
+							SPHG_FREE((info*) C, sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+							// aChild stops the expansion
+							return true;
+						}
+					}
+				}
+
+/*** LABEL ***/	NEXT_STATE_PREDICATES:
+				// Increase the number in P, possibly re-setting a digit to 0 when the increase reaches the size of a vector in C
+				i = 0;	// Start with precondition number 0
+				while ((i < NumberOfPositivePreconditions) && ((++P[i]) == C[i]->size()))
+				{
+					P[i] = 0;
+					++i;
+				}
+			}
+			// When the NumberOfPositivePreconditions has been reached, it means that all possible combinations of predicates
+			// from aState have been generated and tested against the positive preconditions of Op; so it's time to break this loop
+			while (i < NumberOfPositivePreconditions);
+
+#if (STL == MEMORY_ALLOCATION)
+			// Nothing to do here: the STL takes care of the memory management for its containers
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+			SPHG_FREE(theParametersOfaCandidate);
+			SPHG_FREE(D);
+			SPHG_FREE(P);
+#elif (HPHA == MEMORY_ALLOCATION)
+			//of << "{theParametersOfaCandidate, free3, " << (unsigned long) theParametersOfaCandidate << ", " << R.TimeStamp() << ", " << aCandidate->GettheNumberOfParameters() * sizeof(PDDL::Parameter) << ", " << sizeof(PDDL::Parameter) << "}," << std::endl;
+			SPHG_FREE((PDDL::Parameters) theParametersOfaCandidate, sizeof(PDDL::Parameter) * aCandidate->GettheNumberOfParameters(), sizeof(PDDL::Parameter));
+			//of << "{D, free3, " << (unsigned long) D << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
+			SPHG_FREE((PDDL::HPredicate*) D, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
+			//of << "{P, free3, " << (unsigned long) P << ", " << R.TimeStamp() << ", " << sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions << ", " << sizeof(PDDL::HPredicate) << "}," << std::endl;
+			SPHG_FREE((PDDL::HPredicate*) P, sizeof(PDDL::HPredicate) * NumberOfPositivePreconditions, sizeof(PDDL::HPredicate));
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+		}
+
+#if (STL == MEMORY_ALLOCATION)
+		// Nothing to do here: the STL takes care of the memory management for its containers
+#elif ((DL_MALLOC == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION))
+		SPHG_FREE(C);
+#elif (HPHA == MEMORY_ALLOCATION)
+		//of << "{C, free4, " << (unsigned long) C << ", " << R.TimeStamp() << ", " << sizeof(info) * NumberOfPositivePreconditions << ", " << sizeof(info) << "}," << std::endl;
+		SPHG_FREE((info*) C, sizeof(info) * NumberOfPositivePreconditions, sizeof(info));
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+	}
+
+	// aChild did not stop the expansion
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BreadthExpand/0
+//
+bool StateSpaceForwardChaining::BreadthExpand() {
+
+	// Get the front node of theOpen
+	const SearchNode::HNode aParent = theOpen.front();
+	// Get a copy of the current state of aParent (inserting new states into theStates may move it)
+	const State aCurrentState(theStates.GettheState(theNodes[aParent].GettheState()));
+
+	// Compute children for each possible operator from theDomainOperators; AddBreadthChild/4 reports a solution
+	theExpandedNode = aParent;
+	theExpandedState = &aCurrentState;
+	return StateSpaceForwardChaining::ApplytheOperators(aCurrentState, &StateSpaceForwardChaining::AddBreadthChild);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::AddBreadthChild/4
+//
+bool StateSpaceForwardChaining::AddBreadthChild(const Operator* anOperator, Domain::HOperator, LiftedParameters someParameters, const State& aState) {
+	// Copy the parent node, as inserting children into theNodes may move it
+	const SearchNode aNode = theNodes[theExpandedNode];
+	const State& aCurrentState = *theExpandedState;
+
+	// Put the resulting state into theStates data store and make a child node when this state is new
+	std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, aNode.GettheState(), aCurrentState);
+	if (new_state.second)
+	{
+		// Remember this child node leading to this new state
+		Operator::OperatorSignature tempOS = anOperator->MaketheOperatorSignature(someParameters);
+		SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+		theNodes.push_back(SearchNode(new_state.first, theExpandedNode, AddOperatorSignature(tempOS), aNode.GettheCost() + 1));	// 1 operator has been added: Add 1 to the length of this plan
+
+		// Report immediately when this child plan is a solution
+		if (Included(aState, theFinalState))
+		{
+			// Memorize this child plan as the current solution
+			thePlanFound = StateSpaceForwardChaining::MakethePlan(new_node);
+			theCostOfthePlanFound = StateSpaceForwardChaining::GettheCostOf(thePlanFound);
+
+			// Report this child plan is a solution
+			return true;
+		}
+
+		// This child plan IS NOT a solution; enqueue it so as to BreadthExpand/0 it later
+		theOpen.push_back(new_node);
+	}
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::GroundedBreadthExpand/0
+//
+bool StateSpaceForwardChaining::GroundedBreadthExpand() {
+
+	// Get the front node of theOpen (a copy, as inserting children into theNodes may move it)
+	const SearchNode::HNode aParent = theOpen.front();
+	const SearchNode aNode = theNodes[aParent];
+	// Get a copy of the current state of aNode (inserting new states into theStates may move it)
+	const State aCurrentState(theStates.GettheState(aNode.GettheState()));
+
+	// Compute children for each applicable grounded action, in the order BreadthExpand/0 would compute them
+	StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, theApplicableActions);
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+	{
+		const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+
+		State aState(aCurrentState);
+		anAction.Apply(aState);
+		StateSpaceForwardChaining::Canonicalize(aState);
+
+		// Put the resulting state into theStates data store and make a child node when this state is new
+		std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, aNode.GettheState(), aCurrentState);
+		if (new_state.second)
+		{
+			SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+			theNodes.push_back(SearchNode(new_state.first, aParent, anAction.GettheOperatorSignature(), aNode.GettheCost() + 1));	// 1 operator has been added: Add 1 to the length of this plan
+
+			// Report immediately when this child plan is a solution
+			if (Included(aState, theFinalState))
+			{
+				thePlanFound = StateSpaceForwardChaining::MakethePlan(new_node);
+				theCostOfthePlanFound = StateSpaceForwardChaining::GettheCostOf(thePlanFound);
+				return true;
+			}
+
+			// This child plan IS NOT a solution; enqueue it so as to expand it later
+			theOpen.push_back(new_node);
+		}
+	}
+
+	// Report that no solution has been found during this expansion; maybe next time...
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StartBreadthFirst/0
+//
+bool StateSpaceForwardChaining::StartBreadthFirst() {
+	StateSpaceForwardChaining::StartBudget();
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+
+	// Prepare for the ride on the Planning Frontier
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpen.push_back(0);
+	theStartedSearch = STARTED_BREADTH_FIRST;
+	theStatus = SEARCH_IN_PROGRESS;
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BreadthFirst/1
+//
+bool StateSpaceForwardChaining::BreadthFirst(bool memory_consumption_is_measured /* default value is false */) {
+	StateSpaceForwardChaining::StartBudget();
+
+	IterationNumber theCurrentIteration = 0;		// No iteration in the while loop below, yet (we won't iterate when theInitialState is included in theFinalState
+	size_t s_open = 0;								// theOpen initially is empty
+	s_open_Max = 0;									// Record the maximum memory size of the search
+
+	//s = "memory heat map.txt";
+	//of.open(s.c_str());
+	//of.setf(std::ios_base::fixed, std::ios_base::floatfield);
+	//of.precision(8);
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+	else // TheFinalState IS NOT INCLUDED in the InitialState: this search starts now...
+	{
+		SearchFrontier::iterator theOpen_last;	// used to compute memory size of theOpen
+
+		// Prepare for the ride on the Planning Frontier
+		theNodes.push_back(SearchNode(theInitialState));
+		theOpen.push_back(0);
+
+		// When the user wants to know more about the memory consumption, record the movements on theOpen
+		if (memory_consumption_is_measured)
+		{
+			s_open = sizeof(theOpen) + sizeof(theOpen.front());
+			s_open_Max = s_open;
+			theOpen_last = theOpen.begin();
+		}
+
+		// ... and go for it!
+		while (!theOpen.empty() && !MustStop())
+		{// StateSpaceForwardChaining as long as there are Plans to expand
+
+			// Compute the children of the first plan appearing in theOpen
+			if (theActionsAreGrounded ? GroundedBreadthExpand() : BreadthExpand())
+			{
+				// BreadthExpand/0 memorized the solution child into thePlanFound
+
+				// No need for heavy memory any longer
+				theOpen.clear();
+
+				// Tell the user you did a good job!
+				return true;
+			}
+
+			// When the user wants to know more about the memory consumption, record the movements on theOpen
+			if (memory_consumption_is_measured)
+			{
+				// Point to the first node added to theOpen by BreadthExpand/0
+				++theOpen_last;
+				// But if BreadthExpand/0 added nothing to theOpen then theOpen_last now points to (theOpen.end())...
+				if (theOpen.end() == theOpen_last)
+					// ... so get one node back in theOpen
+					--theOpen_last;
+				else // (theOpen.end() != theOpen_last)
+					// Count the memory usage of the nodes added to theOpen by BreadthExpand/0
+					for(SearchFrontier::iterator it = theOpen_last; it != theOpen.end(); ++it)
+					{
+						s_open += sizeof(*it);
+						// Remember the memory usage of this node (it points to this node) was counted
+						theOpen_last = it;
+					}
+
+				// Record, if necessary, the maximum memory consumption of theOpen
+				if (s_open_Max < s_open) s_open_Max = s_open;
+
+				std::cout << "Search step #" << (++theCurrentIteration) << " (" << INTERNAL_TYPES::u16(theNodes[theOpen.front()].GettheCost()) << "): "
+					<< theOpen.size() << " open plans for " << s_open << " bytes (Maximum total search size is " 
+					<< StateSpaceForwardChaining::SizeOf() << " bytes)." << std::endl;
+
+				// This substraction is in advance of the call to pop_front/0 just below
+				s_open -= sizeof(theOpen.front());
+			}
+
+			// No child-plan is a solution: pop the parent-plan from the search frontier
+			theOpen.pop_front();					
+		}
+
+		// Tell the user the search space became empty, or the search was cancelled or ran out of budget, before a solution was found
+		return false;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::CostExpand/0
+//
+bool StateSpaceForwardChaining::CostExpand() {
+
+	// Get the lowest cost node of theOpenWithCosts
+	const SearchNode::HNode aParent = theOpenWithCosts.top().second;
+	// Get a copy of the current state of aParent (inserting new states into theStates may move it)
+	const State aCurrentState(theStates.GettheState(theNodes[aParent].GettheState()));
+	// As inserting children nodes shall modify the top node, pop aParent (i.e. the current top node) NOW from the search frontier
+	theOpenWithCosts.pop();
+
+	// Compute children for each possible operator from theDomainOperators; AddCostChild/4 reports a solution
+	theExpandedNode = aParent;
+	theExpandedState = &aCurrentState;
+	return StateSpaceForwardChaining::ApplytheOperators(aCurrentState, &StateSpaceForwardChaining::AddCostChild);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::AddCostChild/4
+//
+bool StateSpaceForwardChaining::AddCostChild(const Operator* anOperator, Domain::HOperator Op, LiftedParameters someParameters, const State& aState) {
+	// Copy the parent node, as inserting children into theNodes may move it
+	const SearchNode aNode = theNodes[theExpandedNode];
+	const State& aCurrentState = *theExpandedState;
+	const PDDL::Number aCost = aNode.GettheCost();
+
+	// Put the resulting state into theStates data store and make a child node when this state is new
+	std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, aNode.GettheState(), aCurrentState);
+	if (new_state.second)
+	{
+		// Remember this child
+		Operator::OperatorSignature tempsOS = anOperator->MaketheOperatorSignature(someParameters);
+		SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+		theNodes.push_back(SearchNode(new_state.first, theExpandedNode, AddOperatorSignature(tempsOS), 1 + aCost + theDomain->GetNumericCost(Op)));	// 1 operator has been added: Add 1 to the cost of this plan
+
+		// Report immediately when this child is a solution
+		if (Included(aState, theFinalState))
+		{
+			thePlanFound = StateSpaceForwardChaining::MakethePlan(new_node);
+			theCostOfthePlanFound = theNodes[new_node].GettheCost();
+
+			// Report this child is a solution
+			return true;
+		}
+
+		// Remember this child plan with its cost in the priority queue
+		theOpenWithCosts.push(NodeWithCost(theNodes[new_node].GettheCost(), new_node));
+	}
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::GroundedCostExpand/0
+//
+bool StateSpaceForwardChaining::GroundedCostExpand() {
+
+	// Get the lowest cost of theOpenWithCosts
+	const PDDL::Number aCost = theOpenWithCosts.top().first;
+	// Get the lowest cost node of theOpenWithCosts (a copy, as inserting children into theNodes may move it)
+	const SearchNode::HNode aParent = theOpenWithCosts.top().second;
+	// Get a copy of the current state of aNode (inserting new states into theStates may move it)
+	const State aCurrentState(theStates.GettheState(theNodes[aParent].GettheState()));
+	// As inserting children nodes shall modify the top node, pop aNode (i.e. the current top node) NOW from the search frontier
+	theOpenWithCosts.pop();
+
+	// Compute children for each applicable grounded action, in the order CostExpand/0 would compute them
+	StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, theApplicableActions);
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+	{
+		const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+
+		State aState(aCurrentState);
+		anAction.Apply(aState);
+		StateSpaceForwardChaining::Canonicalize(aState);
+
+		// Put the resulting state into theStates data store and make a child node when this state is new
+		std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, theNodes[aParent].GettheState(), aCurrentState);
+		if (new_state.second)
+		{
+			SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+			theNodes.push_back(SearchNode(new_state.first, aParent, anAction.GettheOperatorSignature(), 1 + aCost + anAction.GettheCost()));	// 1 operator has been added: Add 1 to the cost of this plan
+
+			// Report immediately when this child is a solution
+			if (Included(aState, theFinalState))
+			{
+				thePlanFound = StateSpaceForwardChaining::MakethePlan(new_node);
+				theCostOfthePlanFound = theNodes[new_node].GettheCost();
+				return true;
+			}
+
+			// Remember this child plan with its cost in the priority queue
+			theOpenWithCosts.push(NodeWithCost(theNodes[new_node].GettheCost(), new_node));
+		}
+	}
+
+	// Report that no solution has been found during this expansion; maybe next time...
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StartBestFirst/0
+//
+bool StateSpaceForwardChaining::StartBestFirst() {
+	StateSpaceForwardChaining::StartBudget();
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+
+	// Prepare for the ride on the Planning Frontier
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpenWithCosts.push(NodeWithCost(0.0f, 0));
+	theStartedSearch = STARTED_BEST_FIRST;
+	theStatus = SEARCH_IN_PROGRESS;
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BestFirst/0
+//
+bool StateSpaceForwardChaining::BestFirst() {
+
+	// Check whether theFinalState is included in theInitialState, then prepare for the ride on the Planning Frontier...
+	if (StateSpaceForwardChaining::StartBestFirst())
+		return true;
+
+	// ... and go for it!
+	while (SEARCH_IN_PROGRESS == theStatus)
+		if (StateSpaceForwardChaining::ExpandtheStartedSearch())
+			return true;
+
+	// Tell the user the search space became empty, or the search was cancelled or ran out of budget, before a solution was found
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::AStarExpand/1
+//
+bool StateSpaceForwardChaining::AStarExpand(Heuristic& aHeuristic) {
+
+	// Get the lowest estimated cost node of theOpenWithEstimates and pop it NOW, as pushing its children shall modify the top node
+	const SearchNode::HNode aParent = theOpenWithEstimates.top().theNode;
+	theOpenWithEstimates.pop();
+	// Get a copy of aParent (inserting children into theNodes may move it)
+	const SearchNode aNode = theNodes[aParent];
+
+	// Skip aNode when a cheaper plan to its state has been found since it was pushed
+	if (theBestCosts[aNode.GettheState()] < aNode.GettheCost())
+		return false;
+
+	// Get a copy of the current state of aNode (inserting new states into theStates may move it)
+	const State aCurrentState(theStates.GettheState(aNode.GettheState()));
+
+	// The goal is tested when a node is expanded, not when it is generated: no cheaper plan can then be waiting in theOpenWithEstimates
+	if (Included(aCurrentState, theFinalState))
+	{
+		thePlanFound = StateSpaceForwardChaining::MakethePlan(aParent);
+		theCostOfthePlanFound = aNode.GettheCost();
+		return true;
+	}
+
+	StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, theApplicableActions);
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+	{
+		const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+		const PDDL::Number aCost = 1 + aNode.GettheCost() + anAction.GettheCost();	// 1 operator has been added: Add 1 to the cost of this plan, as CostExpand/0 does
+
+		State aState(aCurrentState);
+		anAction.Apply(aState);
+		StateSpaceForwardChaining::Canonicalize(aState);
+
+		// Estimate the resulting state once, when it is new; otherwise (re)open it only when this plan to it is cheaper
+		std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, aNode.GettheState(), aCurrentState);
+		if (new_state.second)
+		{
+			theBestCosts.resize(theStates.Size(), Heuristic::DEAD_END);
+			theEstimates.resize(theStates.Size(), Heuristic::DEAD_END);
+			theEstimates[new_state.first] = aHeuristic.Evaluate(aState);
+		}
+		else if (theBestCosts[new_state.first] <= aCost)
+			continue;
+
+		theBestCosts[new_state.first] = aCost;
+
+		// The goal cannot be reached from a dead end
+		const PDDL::Number anEstimate = theEstimates[new_state.first];
+		if (Heuristic::DEAD_END == anEstimate)
+			continue;
+
+		SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+		theNodes.push_back(SearchNode(new_state.first, aParent, anAction.GettheOperatorSignature(), aCost));
+		theOpenWithEstimates.push(NodeWithEstimate(aCost + anEstimate, anEstimate, new_node));
+	}
+
+	// Report that no solution has been found during this expansion; maybe next time...
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StartAStar/1
+//
+bool StateSpaceForwardChaining::StartAStar(Heuristic& aHeuristic) {
+	StateSpaceForwardChaining::StartBudget();
+
+	// aHeuristic and the expansion of the nodes both work on theGroundedActions
+	if (! theActionsAreGrounded)
+		return false;
+
+	// Estimate theInitialState; no need to search from a dead end
+	const State& anInitialState = theStates.GettheState(theInitialState);
+	const PDDL::Number anEstimate = aHeuristic.Evaluate(anInitialState);
+	if (Heuristic::DEAD_END == anEstimate)
+		return false;
+
+	theBestCosts.assign(theStates.Size(), Heuristic::DEAD_END);
+	theEstimates.assign(theStates.Size(), Heuristic::DEAD_END);
+	theBestCosts[theInitialState] = 0.0f;
+	theEstimates[theInitialState] = anEstimate;
+
+	// Prepare for the ride on the Planning Frontier: the goal is tested when a node is expanded
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpenWithEstimates.push(NodeWithEstimate(anEstimate, anEstimate, 0));
+	theStartedSearch = STARTED_ASTAR;
+	theStartedHeuristic = &aHeuristic;
+	theStatus = SEARCH_IN_PROGRESS;
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::AStar/1
+//
+bool StateSpaceForwardChaining::AStar(Heuristic& aHeuristic) {
+
+	// Estimate theInitialState and prepare for the ride on the Planning Frontier...
+	StateSpaceForwardChaining::StartAStar(aHeuristic);
+
+	// ... and go for it!
+	while (SEARCH_IN_PROGRESS == theStatus)
+		if (StateSpaceForwardChaining::ExpandtheStartedSearch())
+			return true;
+
+	// Tell the user the search space became empty, or the search was cancelled or ran out of budget, before a solution was found
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::GreedyExpand/1
+//
+// The children of a node are not evaluated when they are generated but when they are expanded: they
+// wait in the search frontiers with the estimate of their parent. Plans are reported as soon as they
+// reach the goal: greedy searches are about finding a plan fast, not a cheap one.
+//
+bool StateSpaceForwardChaining::GreedyExpand(Heuristic& aHeuristic) {
+
+	// Pop a node from the search frontier with the lowest priority; prefer thePreferredOpenWithCosts on ties
+	SearchNode::HNode aParent;
+	if (!thePreferredOpenWithCosts.empty() && (theOpenWithCosts.empty() || (thePreferredPriority <= theRegularPriority)))
+	{
+		aParent = thePreferredOpenWithCosts.top().second;
+		thePreferredOpenWithCosts.pop();
+		++thePreferredPriority;
+	}
+	else
+	{
+		aParent = theOpenWithCosts.top().second;
+		theOpenWithCosts.pop();
+		++theRegularPriority;
+	}
+	// Get a copy of aParent (inserting children into theNodes may move it)
+	const SearchNode aNode = theNodes[aParent];
+
+	// A node may be in both search frontiers: expand its state only once
+	if (theExpandedStates[aNode.GettheState()])
+		return false;
+	theExpandedStates[aNode.GettheState()] = true;
+
+	// Get a copy of the current state of aNode (inserting new states into theStates may move it)
+	const State aCurrentState(theStates.GettheState(aNode.GettheState()));
+
+	// The goal cannot be reached from a dead end
+	const PDDL::Number anEstimate = aHeuristic.Evaluate(aCurrentState);
+	if (Heuristic::DEAD_END == anEstimate)
+		return false;
+
+	// Boost thePreferredOpenWithCosts each time the search makes progress towards the goal
+	if (anEstimate < theBestEstimate)
+	{
+		theBestEstimate = anEstimate;
+		thePreferredPriority -= 1000;
+	}
+
+	// Both theApplicableActions and the preferred actions are in increasing order: walk them along
+	const std::vector<GroundedAction::HAction>& somePreferredActions = aHeuristic.GetthePreferredActions();
+	std::vector<GroundedAction::HAction>::size_type p = 0;
+
+	StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, theApplicableActions);
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+	{
+		while ((p < somePreferredActions.size()) && (somePreferredActions[p] < theApplicableActions[a]))
+			++p;
+		const bool anActionIsPreferred = ((p < somePreferredActions.size()) && (somePreferredActions[p] == theApplicableActions[a]));
+
+		const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+
+		State aState(aCurrentState);
+		anAction.Apply(aState);
+		StateSpaceForwardChaining::Canonicalize(aState);
+
+		// Put the resulting state into theStates data store and make a child node when this state is new
+		std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, aNode.GettheState(), aCurrentState);
+		if (new_state.second)
+		{
+			theExpandedStates.resize(theStates.Size(), false);
+
+			SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+			theNodes.push_back(SearchNode(new_state.first, aParent, anAction.GettheOperatorSignature(), 1 + aNode.GettheCost() + anAction.GettheCost()));	// 1 operator has been added: Add 1 to the cost of this plan
+
+			// Report immediately when this child is a solution
+			if (Included(aState, theFinalState))
+			{
+				thePlanFound = StateSpaceForwardChaining::MakethePlan(new_node);
+				theCostOfthePlanFound = theNodes[new_node].GettheCost();
+				return true;
+			}
+
+			theOpenWithCosts.push(NodeWithCost(anEstimate, new_node));
+			if (anActionIsPreferred)
+				thePreferredOpenWithCosts.push(NodeWithCost(anEstimate, new_node));
+		}
+	}
+
+	// Report that no solution has been found during this expansion; maybe next time...
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::StartGreedyBestFirst/1
+//
+bool StateSpaceForwardChaining::StartGreedyBestFirst(Heuristic& aHeuristic) {
+	StateSpaceForwardChaining::StartBudget();
+
+	// aHeuristic and the expansion of the nodes both work on theGroundedActions
+	if (! theActionsAreGrounded)
+		return false;
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+
+	theExpandedStates.assign(theStates.Size(), false);
+	theBestEstimate = Heuristic::DEAD_END;
+	theRegularPriority = 0;
+	thePreferredPriority = 0;
+
+	// Prepare for the ride on the Planning Frontier
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpenWithCosts.push(NodeWithCost(0.0f, 0));
+	theStartedSearch = STARTED_GREEDY_BEST_FIRST;
+	theStartedHeuristic = &aHeuristic;
+	theStatus = SEARCH_IN_PROGRESS;
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::GreedyBestFirst/1
+//
+bool StateSpaceForwardChaining::GreedyBestFirst(Heuristic& aHeuristic) {
+
+	// Check whether theFinalState is included in theInitialState, then prepare for the ride on the Planning Frontier...
+	if (StateSpaceForwardChaining::StartGreedyBestFirst(aHeuristic))
+		return true;
+
+	// ... and go for it!
+	while (SEARCH_IN_PROGRESS == theStatus)
+		if (StateSpaceForwardChaining::ExpandtheStartedSearch())
+			return true;
+
+	// Tell the user the search space became empty, or the search was cancelled or ran out of budget, before a solution was found
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ExpandtheStartedSearch/0
+//
+bool StateSpaceForwardChaining::ExpandtheStartedSearch() {
+	if (SEARCH_IN_PROGRESS != theStatus)
+		return false;
+
+	// The search ends when its frontier becomes empty...
+	bool theFrontierIsEmpty = true;
+	switch (theStartedSearch)
+	{
+		case STARTED_BREADTH_FIRST:		theFrontierIsEmpty = theOpen.empty(); break;
+		case STARTED_BEST_FIRST:		theFrontierIsEmpty = theOpenWithCosts.empty(); break;
+		case STARTED_ASTAR:				theFrontierIsEmpty = theOpenWithEstimates.empty(); break;
+		case STARTED_GREEDY_BEST_FIRST:	theFrontierIsEmpty = (theOpenWithCosts.empty() && thePreferredOpenWithCosts.empty()); break;
+		default: break;
+	}
+	if (theFrontierIsEmpty)
+	{
+		theStatus = SEARCH_COMPLETED;
+		return false;
+	}
+
+	// ... or when it is cancelled or its budget is spent
+	if (StateSpaceForwardChaining::MustStop())
+		return false;
+
+	bool aSolutionWasFound = false;
+	switch (theStartedSearch)
+	{
+		case STARTED_BREADTH_FIRST:
+			{
+				// Compute the children of the first plan appearing in theOpen; when none is a solution, pop this plan from the search frontier
+				aSolutionWasFound = (theActionsAreGrounded ? GroundedBreadthExpand() : BreadthExpand());
+				if (! aSolutionWasFound)
+					theOpen.pop_front();
+				break;
+			}
+		case STARTED_BEST_FIRST:		aSolutionWasFound = (theActionsAreGrounded ? GroundedCostExpand() : CostExpand()); break;
+		case STARTED_ASTAR:				aSolutionWasFound = AStarExpand(*theStartedHeuristic); break;
+		case STARTED_GREEDY_BEST_FIRST:	aSolutionWasFound = GreedyExpand(*theStartedHeuristic); break;
+		default: break;
+	}
+	if (! aSolutionWasFound)
+		return false;
+
+	// The expansion memorized the solution into thePlanFound and its cost into theCostOfthePlanFound: no need for heavy memory any longer
+	theOpen.clear();
+	while (! theOpenWithCosts.empty()) theOpenWithCosts.pop();
+	while (! thePreferredOpenWithCosts.empty()) thePreferredOpenWithCosts.pop();
+	while (! theOpenWithEstimates.empty()) theOpenWithEstimates.pop();
+	theStatus = SEARCH_COMPLETED;
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Step/1
+//
+bool StateSpaceForwardChaining::Step(INTERNAL_TYPES::u32 someExpansions) {
+	for (INTERNAL_TYPES::u32 e = 0; (e < someExpansions) && (SEARCH_IN_PROGRESS == theStatus); ++e)
+		if (StateSpaceForwardChaining::ExpandtheStartedSearch())
+			return true;
+
+	// Tell the user whether the search may go on with GettheStatus/0
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::RunFor/1
+//
+bool StateSpaceForwardChaining::RunFor(INTERNAL_TYPES::u64 someMicroseconds) {
+	const std::chrono::steady_clock::time_point anEnd = std::chrono::steady_clock::now() + std::chrono::microseconds(someMicroseconds);
+
+	// An expansion costs much more than reading the clock; one expansion at least, so that the search always progresses
+	do
+	{
+		if (StateSpaceForwardChaining::ExpandtheStartedSearch())
+			return true;
+	}
+	while ((SEARCH_IN_PROGRESS == theStatus) && (std::chrono::steady_clock::now() < anEnd));
+
+	// Tell the user whether the search may go on with GettheStatus/0
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Replan/2
+//
+// The previous search is reused in three ways: the grounded actions and the successor generator are
+// kept; the previous plan is first replayed from the new initial state, as a small change of the
+// world often leaves it valid; otherwise the states of the previous plan, whose costs to the goal
+// are known from the costs of their plan, become goals of a cheapest-cost-first search from the
+// new initial state, so that the search usually stops well before the goal and the end of the
+// previous plan is appended to the plan found. The repaired plan is then not always the cheapest.
+//
+// The states of the previous plan are goals, not their orbits: the repair does not canonicalize the
+// states, and theSymmetries are only found again from the new initial state for the next searches.
+//
+bool StateSpaceForwardChaining::Replan(const State& someAdditions, const State& someDeletions) {
+
+	// Actions which the added predicates enable may not have been grounded, and the actions needing a deleted static predicate have lost it: a new search is then needed
+	if (!theActionsAreGrounded || !theReachablePredicates.includes(someAdditions) || someDeletions.intersects(theStaticPredicates))
+	{
+		StateSpaceForwardChaining::StartBudget();
+		theStatus = SEARCH_NEEDS_RESTART;
+		return false;
+	}
+
+	theSymmetries.Clear();
+	const bool aPlanIsFound = StateSpaceForwardChaining::Repair(someAdditions, someDeletions);
+	StateSpaceForwardChaining::BuildtheSymmetries(theStates.GettheState(theInitialState));
+
+	return aPlanIsFound;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Repair/2
+//
+// The plans found keep the state where the repair stopped, which is not always the state they reach
+// (cf. GettheResultingState/1): the states actually reached are never inserted into theStates.
+//
+bool StateSpaceForwardChaining::Repair(const State& someAdditions, const State& someDeletions) {
+
+	// 1. Replay the previous plan from the previous initial state: its states and their costs to the goal are the goals of the repair
+	const Operator::HOperatorSignatures thePreviousPlan(*thePlanFound.GettheOperatorSignatures());
+	std::vector<GroundedAction::HAction> thePreviousActions;
+	thePreviousStates.Clear();
+	State aState(theStates.GettheState(theInitialState));
+	thePreviousStates.Insert(aState);
+	for (Operator::HOperatorSignatures::size_type o = 0; o < thePreviousPlan.size(); ++o)
+	{
+		const GroundedAction::HAction a = StateSpaceForwardChaining::GettheAction(thePreviousPlan[o]);
+		if ((GroundedAction::NO_ACTION == a) || !theGroundedActions[a].IsApplicableTo(aState))
+			break;
+		theGroundedActions[a].Apply(aState);
+		if (! thePreviousStates.Insert(aState).second)
+			break;
+		thePreviousActions.push_back(a);
+	}
+	std::vector<PDDL::Number> theCostsToGo(thePreviousActions.size() + 1, 0.0f);
+	if ((thePreviousActions.size() == thePreviousPlan.size()) && Included(aState, theFinalState))
+		for (std::vector<GroundedAction::HAction>::size_type a = thePreviousActions.size(); a > 0; --a)
+			theCostsToGo[a - 1] = theCostsToGo[a] + 1 + theGroundedActions[thePreviousActions[a - 1]].GettheCost();	// 1 operator has been added: Add 1 to the cost of this plan, as CostExpand/0 does
+	else // There is no previous plan, or the previous search did not end at the goal
+	{
+		thePreviousActions.clear();
+		thePreviousStates.Clear();
+	}
+
+	// 2. The new initial state replaces the previous one
+	State anInitialState(theStates.GettheState(theInitialState));
+	anInitialState.remove(someDeletions);
+	anInitialState.add(someAdditions);
+	StateSpaceForwardChaining::Reset();
+	theStates.Clear();
+
+	// Predicates mutex from the previous initial state may no longer be
+	theMutexGroups.Build(theGroundedActions, anInitialState);
+	theStates.Pack((theStatesArePacked && theMutexGroups.IsCompact()) ? &theMutexGroups : 0);
+	theInitialState = theStates.Insert(anInitialState).first;
+	StateSpaceForwardChaining::StartBudget();
+
+	// 3. Is the previous plan still valid?
+	if (0 != thePreviousStates.Size())
+	{
+		aState = anInitialState;
+		std::vector<GroundedAction::HAction>::size_type a = 0;
+		while ((a < thePreviousActions.size()) && theGroundedActions[thePreviousActions[a]].IsApplicableTo(aState))
+			theGroundedActions[thePreviousActions[a++]].Apply(aState);
+		if ((a == thePreviousActions.size()) && Included(aState, theFinalState))
+		{
+			Operator::HOperatorSignatures anOS(thePreviousPlan);
+			thePlanFound = Plan(theInitialState, anOS);
+			theCostOfthePlanFound = theCostsToGo[0];
+			return true;
+		}
+	}
+
+	// 4. Repair: search from the new initial state to the goal or to a state of the previous plan, the goal being tested when a node is expanded
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpenWithCosts.push(NodeWithCost(0.0f, 0));
+	while (!theOpenWithCosts.empty() && !StateSpaceForwardChaining::MustStop())
+	{
+		const PDDL::Number aCost = theOpenWithCosts.top().first;
+		const SearchNode::HNode aParent = theOpenWithCosts.top().second;
+		const State aCurrentState(theStates.GettheState(theNodes[aParent].GettheState()));
+		theOpenWithCosts.pop();
+
+		if (Included(aCurrentState, theFinalState))
+		{
+			thePlanFound = StateSpaceForwardChaining::MakethePlan(aParent);
+			theCostOfthePlanFound = aCost;
+			return true;
+		}
+
+		const StateRegistry::HState p = thePreviousStates.Find(aCurrentState);
+		if (StateRegistry::NO_STATE != p)
+		{
+			// Append the end of the previous plan, from its p-th state
+			Operator::HOperatorSignatures anOS(*StateSpaceForwardChaining::MakethePlan(aParent).GettheOperatorSignatures());
+			for (std::vector<GroundedAction::HAction>::size_type a = p; a < thePreviousActions.size(); ++a)
+				anOS.push_back(theGroundedActions[thePreviousActions[a]].GettheOperatorSignature());
+			thePlanFound = Plan(theNodes[aParent].GettheState(), anOS);
+			theCostOfthePlanFound = aCost + theCostsToGo[p];
+			return true;
+		}
+
+		// theStubbornSets are sound for theFinalState only: the states of the previous plan are goals too
+		if (0 == thePreviousStates.Size())
+			StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, theApplicableActions);
+		else
+			theSuccessorGenerator.GettheApplicableActions(aCurrentState, theApplicableActions);
+		for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+		{
+			const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+
+			State aChild(aCurrentState);
+			anAction.Apply(aChild);
+
+			std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aChild, theNodes[aParent].GettheState(), aCurrentState);
+			if (new_state.second)
+			{
+				SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+				theNodes.push_back(SearchNode(new_state.first, aParent, anAction.GettheOperatorSignature(), 1 + aCost + anAction.GettheCost()));	// 1 operator has been added: Add 1 to the cost of this plan
+				theOpenWithCosts.push(NodeWithCost(theNodes[new_node].GettheCost(), new_node));
+			}
+		}
+	}
+
+	// Tell the user the search space became empty, or the search was cancelled or ran out of budget, before a solution was found
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MaketheSuccessors/2
+//
+void StateSpaceForwardChaining::MaketheSuccessors(const State& aState, Successors& someSuccessors) {
+	someSuccessors.clear();
+
+	if (theActionsAreGrounded)
+	{
+		StateSpaceForwardChaining::GettheApplicableActions(aState, theApplicableActions);
+		someSuccessors.resize(theApplicableActions.size());
+		for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+		{
+			const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+			someSuccessors[a].theState = aState;
+			anAction.Apply(someSuccessors[a].theState);
+			someSuccessors[a].theOperatorSignature.resize(theSharedOperatorSignatures[anAction.GettheOperatorSignature()].size());
+			someSuccessors[a].theOperatorSignature = theSharedOperatorSignatures[anAction.GettheOperatorSignature()];
+			someSuccessors[a].theCost = 1 + anAction.GettheCost();
+		}
+
+		return;
+	}
+
+	// Keep every child, whether its state is new or not: there is no closed set in a depth first search
+	theExpandedSuccessors = &someSuccessors;
+	StateSpaceForwardChaining::ApplytheOperators(aState, &StateSpaceForwardChaining::AddSuccessor);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::AddSuccessor/4
+//
+bool StateSpaceForwardChaining::AddSuccessor(const Operator* anOperator, Domain::HOperator Op, LiftedParameters someParameters, const State& aState) {
+	theExpandedSuccessors->push_back(Successor());
+	Successor& aSuccessor = theExpandedSuccessors->back();
+	aSuccessor.theState = aState;
+	Operator::OperatorSignature tempOS = anOperator->MaketheOperatorSignature(someParameters);
+	aSuccessor.theOperatorSignature.resize(tempOS.size());
+	aSuccessor.theOperatorSignature = tempOS;
+	aSuccessor.theCost = 1 + theDomain->GetNumericCost(Op);
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::DepthFirst/2
+//
+bool StateSpaceForwardChaining::DepthFirst(Heuristic* aHeuristic, PDDL::Number aCost) {
+	// Unwind the recursion as soon as the search is cancelled or its budget is spent
+	if (MustStop())
+		return false;
+
+	const Plan::length_type aDepth = (Plan::length_type) (thePath.size() - 1);
+	const State& aState = *thePath.back();
+
+	// Do not expand the plans whose cost plus estimate exceeds theBound, but remember the cheapest of them for the next iteration
+	const PDDL::Number anEstimatedCost = aCost + ((0 == aHeuristic) ? 0.0f : aHeuristic->Evaluate(aState));
+	if (theBound < anEstimatedCost)
+	{
+		if (anEstimatedCost < theNextBound)
+			theNextBound = anEstimatedCost;
+		return false;
+	}
+
+	// The goal is tested when a state is expanded: all the cheaper plans have been expanded during the previous iterations
+	if (Included(aState, theFinalState))
+	{
+		Operator::HOperatorSignatures someOperatorSignatures;
+		for (Plan::length_type d = 0; d < aDepth; ++d)
+		{
+			Operator::OperatorSignature anOS(theSuccessors[d][theChoices[d]].theOperatorSignature);
+			someOperatorSignatures.push_back(AddOperatorSignature(anOS));
+		}
+		theEndOfthePath = aState;
+		thePlanFound = Plan(StateRegistry::NO_STATE, someOperatorSignatures);
+		theCostOfthePlanFound = aCost;
+		return true;
+	}
+
+	// Skip aState when it has already been expanded as cheaply during this iteration; plans are at most 255 operators long
+	if (theTranspositionTable.Prune(aState, aCost) || ((std::vector<Successors>::size_type) (aDepth + 1) >= theSuccessors.size()))
+		return false;
+
+	StateSpaceForwardChaining::MaketheSuccessors(aState, theSuccessors[aDepth]);
+	for (Successors::size_type c = 0; c < theSuccessors[aDepth].size(); ++c)
+	{
+		// Do not go round in circles along thePath
+		const State& aChild = theSuccessors[aDepth][c].theState;
+		bool aChild_is_on_thePath = false;
+		for (std::vector<const State*>::size_type d = 0; d < thePath.size(); ++d)
+			if (*thePath[d] == aChild)
+			{
+				aChild_is_on_thePath = true;
+				break;
+			}
+		if (aChild_is_on_thePath)
+			continue;
+
+		thePath.push_back(&aChild);
+		theChoices.push_back(c);
+		if (StateSpaceForwardChaining::DepthFirst(aHeuristic, aCost + theSuccessors[aDepth][c].theCost))
+			return true;
+		thePath.pop_back();
+		theChoices.pop_back();
+	}
+
+	// Report that no solution has been found below aState within theBound; maybe during the next iteration...
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::IterativeDeepening/1
+//
+bool StateSpaceForwardChaining::IterativeDeepening(Heuristic* aHeuristic) {
+	StateSpaceForwardChaining::StartBudget();
+
+	// aHeuristic works on theGroundedActions
+	if ((0 != aHeuristic) && !theActionsAreGrounded)
+		return false;
+
+	// One Successors per depth, allocated once: the states of thePath stay where they are during the whole search
+	theSuccessors.resize(1 + std::numeric_limits<Plan::length_type>::max());
+
+	// The transposition table is only allocated by the first depth first search
+	if (0 == theTranspositionTable.Size())
+		theTranspositionTable = TranspositionTable(SPHG_TRANSPOSITION_TABLE_SLOTS);
+
+	// thePath starts with a copy of theInitialState, as it only points to states out of theStates
+	const State anInitialState(theStates.GettheState(theInitialState));
+	theBound = (0 == aHeuristic) ? 0.0f : aHeuristic->Evaluate(anInitialState);
+	while ((Heuristic::DEAD_END != theBound) && (SEARCH_COMPLETED == theStatus))
+	{
+		thePath.assign(1, &anInitialState);
+		theChoices.clear();
+		theNextBound = Heuristic::DEAD_END;
+		theTranspositionTable.NextIteration();
+
+		if (StateSpaceForwardChaining::DepthFirst(aHeuristic, 0.0f))
+		{
+			// DepthFirst/2 memorized the solution into thePlanFound and its cost into theCostOfthePlanFound
+			thePath.clear();
+			theChoices.clear();
+
+			// Tell the user you did a good job!
+			return true;
+		}
+
+		// The next iteration expands the plans up to the cheapest one cut by this iteration
+		theBound = theNextBound;
+	}
+
+	// Tell the user every plan has been expanded and none reaches the goal, or the search was cancelled or ran out of budget
+	thePath.clear();
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::IndextheForwardState/1
+//
+void StateSpaceForwardChaining::IndextheForwardState(StateRegistry::HState aState) {
+	const State& theState = theStates.GettheState(aState);
+	for (State::index_type i = theState.first(); i < State::end(); i = theState.next(i))
+		theForwardStatesByPredicate[i].push_back(aState);
+	theForwardStatesByPredicate[State::end()].push_back(aState);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MeetForward/1
+//
+void StateSpaceForwardChaining::MeetForward(SearchNode::HNode aNode) {
+	const State& aState = theStates.GettheState(theNodes[aNode].GettheState());
+	const PDDL::Number aCost = theNodes[aNode].GettheCost();
+
+	// A backward node satisfied by aState requires its lowest required predicate, which is in aState, or requires nothing
+	for (State::index_type i = aState.first(); ; i = aState.next(i))
+	{
+		const std::vector<SearchNode::HNode>& someBackwardNodes = theBackwardNodesByPredicate[i];
+		for (std::vector<SearchNode::HNode>::size_type n = 0; n < someBackwardNodes.size(); ++n)
+		{
+			const BackwardNode& aBackwardNode = theBackwardNodes[someBackwardNodes[n]];
+			if (aState.includes(aBackwardNode.theRequired) && !aState.intersects(aBackwardNode.theForbidden))
+				if ((SearchNode::NO_NODE == theForwardMeeting)
+					|| ((aCost + aBackwardNode.theCost) < (theNodes[theForwardMeeting].GettheCost() + theBackwardNodes[theBackwardMeeting].theCost)))
+				{
+					theForwardMeeting = aNode;
+					theBackwardMeeting = someBackwardNodes[n];
+				}
+		}
+
+		if (State::end() == i)
+			break;
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MeetBackward/1
+//
+void StateSpaceForwardChaining::MeetBackward(SearchNode::HNode aNode) {
+	const BackwardNode& aBackwardNode = theBackwardNodes[aNode];
+
+	// A state satisfying aBackwardNode includes each of its required predicates: only the states with the rarest one are checked
+	State::index_type r = State::end();
+	for (State::index_type i = aBackwardNode.theRequired.first(); i < State::end(); i = aBackwardNode.theRequired.next(i))
+		if (theForwardStatesByPredicate[i].size() < theForwardStatesByPredicate[r].size())
+			r = i;
+
+	const std::vector<StateRegistry::HState>& someStates = theForwardStatesByPredicate[r];
+	for (std::vector<StateRegistry::HState>::size_type s = 0; s < someStates.size(); ++s)
+	{
+		const State& aState = theStates.GettheState(someStates[s]);
+		if (aState.includes(aBackwardNode.theRequired) && !aState.intersects(aBackwardNode.theForbidden))
+		{
+			const SearchNode::HNode aForwardNode = theForwardNodes[someStates[s]];
+			if ((SearchNode::NO_NODE == theForwardMeeting)
+				|| ((theNodes[aForwardNode].GettheCost() + aBackwardNode.theCost) < (theNodes[theForwardMeeting].GettheCost() + theBackwardNodes[theBackwardMeeting].theCost)))
+			{
+				theForwardMeeting = aForwardNode;
+				theBackwardMeeting = aNode;
+			}
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ForwardLayer/0
+//
+bool StateSpaceForwardChaining::ForwardLayer() {
+	const PDDL::Number aDepth = theNodes[theOpen.front()].GettheCost();
+	while (!theOpen.empty() && (aDepth == theNodes[theOpen.front()].GettheCost()) && !MustStop())
+	{
+		const SearchNode::HNode aParent = theOpen.front();
+		theOpen.pop_front();
+		// Get a copy of the current state of aParent (inserting new states into theStates may move it)
+		const State aCurrentState(theStates.GettheState(theNodes[aParent].GettheState()));
+
+		StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, theApplicableActions);
+		for (std::vector<GroundedAction::HAction>::size_type a = 0; a < theApplicableActions.size(); ++a)
+		{
+			const GroundedAction& anAction = theGroundedActions[theApplicableActions[a]];
+
+			State aState(aCurrentState);
+			anAction.Apply(aState);
+
+			// Put the resulting state into theStates data store and make a child node when this state is new
+			std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aState, theNodes[aParent].GettheState(), aCurrentState);
+			if (new_state.second)
+			{
+				SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+				theNodes.push_back(SearchNode(new_state.first, aParent, anAction.GettheOperatorSignature(), aDepth + 1));	// 1 operator has been added: Add 1 to the length of this plan
+				theForwardNodes.resize(theStates.Size(), (SearchNode::HNode) SearchNode::NO_NODE);
+				theForwardNodes[new_state.first] = new_node;
+				StateSpaceForwardChaining::IndextheForwardState(new_state.first);
+
+				StateSpaceForwardChaining::MeetForward(new_node);
+				theOpen.push_back(new_node);
+			}
+		}
+	}
+
+	// All the plans of this depth are in theOpen, unless the search stopped: the shortest plan through them is known
+	return ((SEARCH_COMPLETED == theStatus) && (SearchNode::NO_NODE != theForwardMeeting));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::BackwardLayer/0
+//
+// Regressing a backward node through a grounded action gives the predicates which must (resp. must
+// not) hold before this action so that the predicates of the node hold (resp. do not hold) after it:
+//		theRequired' = (theRequired - theAdditions) + thePreconditions
+//		theForbidden' = (theForbidden - (theDeletions - theAdditions)) + theNegativePreconditions
+// The action must achieve a predicate of the node, and must not delete a required predicate nor add a forbidden one.
+//
+bool StateSpaceForwardChaining::BackwardLayer() {
+	const PDDL::Number aDepth = theBackwardNodes[theBackwardOpen.front()].theCost;
+	while (!theBackwardOpen.empty() && (aDepth == theBackwardNodes[theBackwardOpen.front()].theCost) && !MustStop())
+	{
+		const SearchNode::HNode aParent = theBackwardOpen.front();
+		theBackwardOpen.pop_front();
+		// Get a copy of aParent (pushing new nodes into theBackwardNodes may move it)
+		const BackwardNode aNode = theBackwardNodes[aParent];
+
+		for (GroundedAction::HAction a = 0; a < theGroundedActions.size(); ++a)
+		{
+			const GroundedAction& anAction = theGroundedActions[a];
+			State theDeletedPredicates(anAction.GettheDeletions());
+			theDeletedPredicates.remove(anAction.GettheAdditions());
+
+			// Is anAction relevant and consistent?
+			if (!anAction.GettheAdditions().intersects(aNode.theRequired) && !theDeletedPredicates.intersects(aNode.theForbidden))
+				continue;
+			if (theDeletedPredicates.intersects(aNode.theRequired) || anAction.GettheAdditions().intersects(aNode.theForbidden))
+				continue;
+
+			BackwardNode aChild;
+			aChild.theRequired = aNode.theRequired;
+			aChild.theRequired.remove(anAction.GettheAdditions());
+			aChild.theRequired.add(anAction.GetthePreconditions());
+			aChild.theForbidden = aNode.theForbidden;
+			aChild.theForbidden.remove(theDeletedPredicates);
+			aChild.theForbidden.add(anAction.GettheNegativePreconditions());
+
+			// No state can both include and exclude a predicate, and no state reached from theInitialState includes an unreachable predicate
+			if (aChild.theRequired.intersects(aChild.theForbidden) || !theReachablePredicates.includes(aChild.theRequired))
+				continue;
+
+			// Make a child node when it is new
+			std::pair<StateRegistry::HState, bool> new_required = theBackwardRequired.Insert(aChild.theRequired);
+			if (new_required.second)
+				theBackwardNodesByRequired.resize(theBackwardRequired.Size());
+			std::vector<SearchNode::HNode>& someBackwardNodes = theBackwardNodesByRequired[new_required.first];
+			bool aChild_is_new = true;
+			for (std::vector<SearchNode::HNode>::size_type n = 0; n < someBackwardNodes.size(); ++n)
+				if (theBackwardNodes[someBackwardNodes[n]].theForbidden == aChild.theForbidden)
+				{
+					aChild_is_new = false;
+					break;
+				}
+			if (! aChild_is_new)
+				continue;
+
+			aChild.theParent = aParent;
+			aChild.theAction = a;
+			aChild.theCost = aDepth + 1;	// 1 operator has been added: Add 1 to the length of this plan
+
+			SearchNode::HNode new_node = (SearchNode::HNode) theBackwardNodes.size();
+			theBackwardNodes.push_back(aChild);
+			someBackwardNodes.push_back(new_node);
+			theBackwardNodesByPredicate[aChild.theRequired.first()].push_back(new_node);
+
+			StateSpaceForwardChaining::MeetBackward(new_node);
+			theBackwardOpen.push_back(new_node);
+		}
+	}
+
+	// All the plans of this depth are in theBackwardOpen, unless the search stopped: the shortest plan through them is known
+	return ((SEARCH_COMPLETED == theStatus) && (SearchNode::NO_NODE != theForwardMeeting));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MaketheBidirectionalPlan/0
+//
+// Both searches count the operators of the plans, so as to meet in the shortest plan: the cost of the
+// plan found is the sum of the costs of its actions. The plan keeps the state of theForwardMeeting
+// (cf. GettheResultingState/1).
+//
+void StateSpaceForwardChaining::MaketheBidirectionalPlan() {
+	// The forward plan leads from theInitialState to the state of theForwardMeeting...
+	Plan aForwardPlan = StateSpaceForwardChaining::MakethePlan(theForwardMeeting);
+	Operator::HOperatorSignatures anOS(*aForwardPlan.GettheOperatorSignatures());
+	PDDL::Number aCost = 0.0f;
+	for (Operator::HOperatorSignatures::size_type o = 0; o < anOS.size(); ++o)
+		aCost += 1 + theGroundedActions[StateSpaceForwardChaining::GettheAction(anOS[o])].GettheCost();	// 1 operator has been added: Add 1 to the cost of this plan, as CostExpand/0 does
+
+	// ... and the actions of the backward plan lead from there to theFinalState
+	for (SearchNode::HNode b = theBackwardMeeting; SearchNode::NO_NODE != theBackwardNodes[b].theParent; b = theBackwardNodes[b].theParent)
+	{
+		const GroundedAction& anAction = theGroundedActions[theBackwardNodes[b].theAction];
+		anOS.push_back(anAction.GettheOperatorSignature());
+		aCost += 1 + anAction.GettheCost();
+	}
+
+	thePlanFound = Plan(theNodes[theForwardMeeting].GettheState(), anOS);
+	theCostOfthePlanFound = aCost;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Bidirectional/0
+//
+bool StateSpaceForwardChaining::Bidirectional() {
+	StateSpaceForwardChaining::StartBudget();
+
+	// The backward search regresses theGroundedActions
+	if (! theActionsAreGrounded)
+		return false;
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+
+	theForwardMeeting = SearchNode::NO_NODE;
+	theBackwardMeeting = SearchNode::NO_NODE;
+
+	// Prepare for the ride forward from theInitialState...
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpen.push_back(0);
+	theForwardNodes.assign(theStates.Size(), (SearchNode::HNode) SearchNode::NO_NODE);
+	theForwardNodes[theInitialState] = 0;
+	theForwardStatesByPredicate.assign(State::end() + 1, std::vector<StateRegistry::HState>());
+	StateSpaceForwardChaining::IndextheForwardState(theInitialState);
+
+	// ... and backward from theFinalState
+	BackwardNode aRoot;
+	aRoot.theRequired = theFinalState;
+	aRoot.theParent = SearchNode::NO_NODE;
+	aRoot.theAction = 0;
+	aRoot.theCost = 0.0f;
+	theBackwardNodes.push_back(aRoot);
+	theBackwardOpen.push_back(0);
+	theBackwardRequired.Insert(aRoot.theRequired);
+	theBackwardNodesByRequired.assign(1, std::vector<SearchNode::HNode>(1, 0));
+	theBackwardNodesByPredicate.assign(State::end() + 1, std::vector<SearchNode::HNode>());
+	theBackwardNodesByPredicate[aRoot.theRequired.first()].push_back(0);
+
+	// Expand a whole layer of the smallest search frontier, as long as both frontiers have nodes to expand
+	while (!theOpen.empty() && !theBackwardOpen.empty() && (SEARCH_COMPLETED == theStatus))
+	{
+		if ((theOpen.size() <= theBackwardOpen.size()) ? ForwardLayer() : BackwardLayer())
+		{
+			StateSpaceForwardChaining::MaketheBidirectionalPlan();
+
+			// No need for heavy memory any longer
+			theOpen.clear();
+			theBackwardOpen.clear();
+
+			// Tell the user you did a good job!
+			return true;
+		}
+	}
+
+	// Tell the user one search space became empty, or the search was cancelled or ran out of budget, before the searches met
+	theOpen.clear();
+	theBackwardOpen.clear();
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ExpandthePartOftheLayer/1
+//
+void StateSpaceForwardChaining::ExpandthePartOftheLayer(BreadthWorkers::size_type aWorker) {
+	BreadthWorker& aBreadthWorker = theBreadthWorkers[aWorker];
+	aBreadthWorker.theChildren.clear();
+
+	for (SearchFrontier::size_type n = aBreadthWorker.theFirstNode; n < aBreadthWorker.theLastNode; ++n)
+	{
+		const SearchNode::HNode aParent = theOpen[n];
+		const State aCurrentState(theStates.GettheState(theNodes[aParent].GettheState()));
+
+		StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, aBreadthWorker.theApplicableActions, aBreadthWorker.theStack, aBreadthWorker.theStubbornScratch);
+		for (std::vector<GroundedAction::HAction>::size_type a = 0; a < aBreadthWorker.theApplicableActions.size(); ++a)
+		{
+			BreadthChild aChild;
+			aChild.theState = aCurrentState;
+			theGroundedActions[aBreadthWorker.theApplicableActions[a]].Apply(aChild.theState);
+			StateSpaceForwardChaining::Canonicalize(aChild.theState);	// theSymmetries are only read: the threads share them
+
+			// The states of the previous layers are all in theStates, which no thread modifies during this layer
+			if (StateRegistry::NO_STATE != theStates.Find(aChild.theState))
+				continue;
+
+			aChild.theParent = aParent;
+			aChild.theAction = aBreadthWorker.theApplicableActions[a];
+			aChild.theGoalIsReached = Included(aChild.theState, theFinalState);
+			aBreadthWorker.theChildren.push_back(aChild);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ParallelBreadthFirst/1
+//
+// Each layer of theOpen is cut into consecutive ranges of nodes, one per thread. The threads only read
+// the search structures and write their children into their own BreadthWorker; then the children are
+// merged into theStates and theNodes by this thread, range after range, so that the new nodes, and the
+// plan found, are exactly those of BreadthFirst/1 with theGroundedActions, whatever the number of threads.
+//
+bool StateSpaceForwardChaining::ParallelBreadthFirst(unsigned int someThreads /* default value is 0 */) {
+	StateSpaceForwardChaining::StartBudget();
+
+	// The threads share theSuccessorGenerator and theGroundedActions, but cannot share the scratch of the operators of theDomain
+	if (! theActionsAreGrounded)
+		return false;
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+
+	if (0 == someThreads)
+		someThreads = std::thread::hardware_concurrency();
+	if (0 == someThreads)
+		someThreads = 1;
+	theBreadthWorkers.resize(someThreads);
+
+	// Prepare for the ride on the Planning Frontier
+	theNodes.push_back(SearchNode(theInitialState));
+	theOpen.push_back(0);
+
+	std::vector<std::thread> theThreads;
+	while (!theOpen.empty() && !MustStop((INTERNAL_TYPES::u32) theOpen.size()))
+	{
+		// The whole of theOpen is the current layer: share it among the workers...
+		const SearchFrontier::size_type aLayerSize = theOpen.size();
+		BreadthWorkers::size_type someWorkers = aLayerSize / SPHG_PARALLEL_BREADTH_MINIMUM_NODES;
+		if (someWorkers > theBreadthWorkers.size())
+			someWorkers = theBreadthWorkers.size();
+		if (0 == someWorkers)
+			someWorkers = 1;
+		for (BreadthWorkers::size_type w = 0; w < someWorkers; ++w)
+		{
+			theBreadthWorkers[w].theFirstNode = (aLayerSize * w) / someWorkers;
+			theBreadthWorkers[w].theLastNode = (aLayerSize * (w + 1)) / someWorkers;
+		}
+
+		// ... and expand it: this thread is the first worker
+		for (BreadthWorkers::size_type w = 1; w < someWorkers; ++w)
+			theThreads.push_back(std::thread(&StateSpaceForwardChaining::ExpandthePartOftheLayer, this, w));
+		StateSpaceForwardChaining::ExpandthePartOftheLayer(0);
+		for (std::vector<std::thread>::size_type t = 0; t < theThreads.size(); ++t)
+			theThreads[t].join();
+		theThreads.clear();
+
+		// Merge the children in the order of the layer; the first child of a state is the only one kept,
+		// stored from its parent state as BreadthFirst/1 does (cf. SetCompressedStates/1)
+		SearchNode::HNode aParent = SearchNode::NO_NODE;
+		State aParentState;
+		for (BreadthWorkers::size_type w = 0; w < someWorkers; ++w)
+		{
+			const std::vector<BreadthChild>& someChildren = theBreadthWorkers[w].theChildren;
+			for (std::vector<BreadthChild>::size_type c = 0; c < someChildren.size(); ++c)
+			{
+				const BreadthChild& aChild = someChildren[c];
+				if (aParent != aChild.theParent)
+				{
+					aParent = aChild.theParent;
+					aParentState = theStates.GettheState(theNodes[aParent].GettheState());
+				}
+				std::pair<StateRegistry::HState, bool> new_state = theStates.Insert(aChild.theState, theNodes[aParent].GettheState(), aParentState);
+				if (! new_state.second)
+					continue;
+
+				SearchNode::HNode new_node = (SearchNode::HNode) theNodes.size();
+				theNodes.push_back(SearchNode(new_state.first, aChild.theParent, theGroundedActions[aChild.theAction].GettheOperatorSignature(), theNodes[aChild.theParent].GettheCost() + 1));	// 1 operator has been added: Add 1 to the length of this plan
+
+				// Report immediately when this child plan is a solution
+				if (aChild.theGoalIsReached)
+				{
+					thePlanFound = StateSpaceForwardChaining::MakethePlan(new_node);
+					theCostOfthePlanFound = StateSpaceForwardChaining::GettheCostOf(thePlanFound);
+
+					// No need for heavy memory any longer
+					theOpen.clear();
+					for (BreadthWorkers::size_type v = 0; v < theBreadthWorkers.size(); ++v)
+						theBreadthWorkers[v].theChildren.clear();
+
+					// Tell the user you did a good job!
+					return true;
+				}
+
+				// This child plan IS NOT a solution; enqueue it so as to expand it with the next layer
+				theOpen.push_back(new_node);
+			}
+		}
+
+		// The current layer has been expanded
+		theOpen.erase(theOpen.begin(), theOpen.begin() + aLayerSize);
+	}
+
+	// Tell the user the search space became empty, or the search was cancelled or ran out of budget, before a solution was found
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::HashDistributedReceive/3
+//
+void StateSpaceForwardChaining::HashDistributedReceive(HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker, const HDAMessage& aMessage) {
+	HDAWorker& aHDAWorker = aSearch.theWorkers[aWorker];
+
+	// Estimate the state of aMessage once, when it is new; otherwise (re)open it only when this plan to it is cheaper
+	std::pair<StateRegistry::HState, bool> new_state = aHDAWorker.theStates.Insert(aMessage.theState, aMessage.theHashValue);
+	if (new_state.second)
+	{
+		aHDAWorker.theBestCosts.push_back(aMessage.theCost);
+		aHDAWorker.theEstimates.push_back((0 == aHDAWorker.theHeuristic) ? 0.0f : aHDAWorker.theHeuristic->Evaluate(aMessage.theState));
+		aHDAWorker.theParentWorkers.push_back(aMessage.theParentWorker);
+		aHDAWorker.theParentStates.push_back(aMessage.theParentState);
+		aHDAWorker.theActions.push_back(aMessage.theAction);
+	}
+	else if (aHDAWorker.theBestCosts[new_state.first] <= aMessage.theCost)
+		return;
+	else
+	{
+		aHDAWorker.theBestCosts[new_state.first] = aMessage.theCost;
+		aHDAWorker.theParentWorkers[new_state.first] = aMessage.theParentWorker;
+		aHDAWorker.theParentStates[new_state.first] = aMessage.theParentState;
+		aHDAWorker.theActions[new_state.first] = aMessage.theAction;
+	}
+
+	// The goal is tested when a state is received: the search goes on until no open state can lead to a cheaper plan
+	if (Included(aMessage.theState, theFinalState))
+	{
+		std::lock_guard<std::mutex> aLock(aSearch.theIncumbentMutex);
+		if (aMessage.theCost < aSearch.theIncumbentCost.load())
+		{
+			aSearch.theIncumbentCost.store(aMessage.theCost);
+			aSearch.theGoalWorker = aWorker;
+			aSearch.theGoalState = new_state.first;
+		}
+		return;
+	}
+
+	// The goal cannot be reached from a dead end, nor more cheaply than the plan already found
+	const PDDL::Number anEstimate = aHDAWorker.theEstimates[new_state.first];
+	if ((Heuristic::DEAD_END != anEstimate) && (aMessage.theCost + anEstimate < aSearch.theIncumbentCost.load()))
+		aHDAWorker.theOpen.push(NodeWithCost(aMessage.theCost + anEstimate, new_state.first));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::HashDistributedSend/2
+//
+void StateSpaceForwardChaining::HashDistributedSend(HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker) {
+	std::vector<HDABatch*>& someOutboxes = aSearch.theWorkers[aWorker].theOutboxes;
+	for (std::vector<HDABatch*>::size_type w = 0; w < someOutboxes.size(); ++w)
+		if ((0 != someOutboxes[w]) && !someOutboxes[w]->theMessages.empty())
+		{
+			// A batch keeps the search alive until its receiver has received all its messages
+			aSearch.theWork.fetch_add(1);
+			aSearch.theWorkers[w].theInbox.Push(someOutboxes[w]);
+			someOutboxes[w] = 0;
+		}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::HashDistributedExpand/2
+//
+// A thread is busy as long as it has batches to receive or an open state which may lead to a plan
+// cheaper than theIncumbentCost. When it becomes idle, it sends its batches and waits for new ones;
+// theWork counts the busy threads plus the batches not received yet, so that theWork can only be 0
+// when no thread can ever become busy again: the cheapest plan is then the one found.
+//
+void StateSpaceForwardChaining::HashDistributedExpand(HDASearch* aSearch, INTERNAL_TYPES::u32 aWorker) {
+	HDAWorker& aHDAWorker = aSearch->theWorkers[aWorker];
+	const INTERNAL_TYPES::u32 someWorkers = (INTERNAL_TYPES::u32) aSearch->theWorkers.size();
+
+	while (! StateSpaceForwardChaining::HashDistributedMustStop(*aSearch, aWorker))
+	{
+		// Receive the batches sent to this thread
+		for (HDABatch* aBatch = aHDAWorker.theInbox.PopAll(); 0 != aBatch;)
+		{
+			for (std::vector<HDAMessage>::size_type m = 0; m < aBatch->theMessages.size(); ++m)
+				StateSpaceForwardChaining::HashDistributedReceive(*aSearch, aWorker, aBatch->theMessages[m]);
+
+			HDABatch* aNextBatch = aBatch->theNext;
+			delete aBatch;
+			aSearch->theWork.fetch_sub(1);
+			aBatch = aNextBatch;
+		}
+
+		// Get the lowest cost plus estimate state of theOpen, unless it is stale or cannot lead to a cheaper plan
+		StateRegistry::HState aParent = StateRegistry::NO_STATE;
+		while (! aHDAWorker.theOpen.empty())
+		{
+			const NodeWithCost aTop = aHDAWorker.theOpen.top();
+			if (aTop.first >= aSearch->theIncumbentCost.load())
+			{
+				// theIncumbentCost never increases: no state of theOpen shall ever be expanded
+				while (! aHDAWorker.theOpen.empty()) aHDAWorker.theOpen.pop();
+				break;
+			}
+			aHDAWorker.theOpen.pop();
+			if (aTop.first <= aHDAWorker.theBestCosts[aTop.second] + aHDAWorker.theEstimates[aTop.second])
+			{
+				aParent = aTop.second;
+				break;
+			}
+		}
+
+		if (StateRegistry::NO_STATE != aParent)
+		{
+			// Get a copy of the state of aParent (receiving its children may move it)
+			const State aCurrentState(aHDAWorker.theStates.GettheState(aParent));
+			const PDDL::Number aParentCost = aHDAWorker.theBestCosts[aParent];
+
+			StateSpaceForwardChaining::GettheApplicableActions(aCurrentState, aHDAWorker.theApplicableActions, aHDAWorker.theStack, aHDAWorker.theStubbornScratch);
+			for (std::vector<GroundedAction::HAction>::size_type a = 0; a < aHDAWorker.theApplicableActions.size(); ++a)
+			{
+				const GroundedAction& anAction = theGroundedActions[aHDAWorker.theApplicableActions[a]];
+
+				HDAMessage aMessage;
+				aMessage.theState = aCurrentState;
+				anAction.Apply(aMessage.theState);
+				aMessage.theHashValue = StateRegistry::Hash(aMessage.theState);
+				aMessage.theCost = 1 + aParentCost + anAction.GettheCost();	// 1 operator has been added: Add 1 to the cost of this plan, as CostExpand/0 does
+				aMessage.theParentWorker = aWorker;
+				aMessage.theParentState = aParent;
+				aMessage.theAction = aHDAWorker.theApplicableActions[a];
+
+				// The high 32 bits of the hash value choose the owner; the low bits choose the slots of its registry
+				const INTERNAL_TYPES::u32 anOwner = (INTERNAL_TYPES::u32) ((aMessage.theHashValue >> 32) % someWorkers);
+				if (aWorker == anOwner)
+					StateSpaceForwardChaining::HashDistributedReceive(*aSearch, aWorker, aMessage);
+				else
+				{
+					if (0 == aHDAWorker.theOutboxes[anOwner])
+						aHDAWorker.theOutboxes[anOwner] = new HDABatch;
+					aHDAWorker.theOutboxes[anOwner]->theMessages.push_back(aMessage);
+				}
+			}
+
+			aSearch->theExpansions.fetch_add(1, std::memory_order_relaxed);
+			if (0 == (++aHDAWorker.theExpansions % SPHG_HDA_EXPANSIONS_PER_SEND))
+				StateSpaceForwardChaining::HashDistributedSend(*aSearch, aWorker);
+			continue;
+		}
+
+		// Nothing to expand: send the children of the last expansions, then become idle...
+		StateSpaceForwardChaining::HashDistributedSend(*aSearch, aWorker);
+		if (! aHDAWorker.theInbox.Empty())
+			continue;
+		aSearch->theWork.fetch_sub(1);
+
+		// ... until a batch arrives or all the threads are idle with no batch left to receive
+		while (true)
+		{
+			if ((0 == aSearch->theWork.load()) || IsCancelled() || aSearch->theBudgetIsSpent.load(std::memory_order_relaxed))
+				return;
+			if (! aHDAWorker.theInbox.Empty())
+			{
+				// The batches in theInbox are still counted in theWork: it cannot have been 0 since then
+				aSearch->theWork.fetch_add(1);
+				break;
+			}
+			std::this_thread::yield();
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::HashDistributedAStar/1
+//
+// HDA* (Kishimoto, Fukunaga & Botea, 2009): each state belongs to the thread given by its hash value,
+// which alone registers, estimates and expands it; the children of an expansion are sent to their
+// owners in batches, through lock-free queues. A thread expands the lowest cost plus estimate state it
+// owns, so that a plan is found early and then the search goes on, without a global order, until no
+// open state can lead to a cheaper plan: with admissible heuristics, the plan found is cost-optimal.
+//
+bool StateSpaceForwardChaining::HashDistributedAStar(std::vector<Heuristic*>& someHeuristics) {
+	StateSpaceForwardChaining::StartBudget();
+
+	// The heuristics and the expansion of the states all work on theGroundedActions
+	if (!theActionsAreGrounded || someHeuristics.empty())
+		return false;
+
+	// Check whether theFinalState is included in theInitialState
+	if (Included(theStates.GettheState(theInitialState), theFinalState))
+	{
+		// Memorize this empty solution for external access
+		thePlanFound = Plan(theInitialState);
+		theCostOfthePlanFound = 0.0f;
+
+		// Tell the user you did a really good job!
+		return true;
+	}
+
+	const INTERNAL_TYPES::u32 someWorkers = (INTERNAL_TYPES::u32) someHeuristics.size();
+	HDASearch aSearch(someWorkers);
+	for (INTERNAL_TYPES::u32 w = 0; w < someWorkers; ++w)
+	{
+		aSearch.theWorkers[w].theOutboxes.assign(someWorkers, 0);
+		aSearch.theWorkers[w].theHeuristic = someHeuristics[w];
+		aSearch.theWorkers[w].theExpansions = 0;
+		aSearch.theWorkers[w].theNextBudgetCheck = 0;
+	}
+
+	// Send theInitialState to its owner, and start all the threads busy
+	HDAMessage anInitialMessage;
+	anInitialMessage.theState = theStates.GettheState(theInitialState);
+	anInitialMessage.theHashValue = StateRegistry::Hash(anInitialMessage.theState);
+	anInitialMessage.theCost = 0.0f;
+	anInitialMessage.theParentWorker = NO_WORKER;
+	anInitialMessage.theParentState = StateRegistry::NO_STATE;
+	anInitialMessage.theAction = 0;
+	StateSpaceForwardChaining::HashDistributedReceive(aSearch, (INTERNAL_TYPES::u32) ((anInitialMessage.theHashValue >> 32) % someWorkers), anInitialMessage);
+	aSearch.theWork.store(someWorkers);
+
+	// This thread is the first worker
+	std::vector<std::thread> theThreads;
+	for (INTERNAL_TYPES::u32 w = 1; w < someWorkers; ++w)
+		theThreads.push_back(std::thread(&StateSpaceForwardChaining::HashDistributedExpand, this, &aSearch, w));
+	StateSpaceForwardChaining::HashDistributedExpand(&aSearch, 0);
+	for (std::vector<std::thread>::size_type t = 0; t < theThreads.size(); ++t)
+		theThreads[t].join();
+
+	// The batches not received when the search was cancelled
+	for (INTERNAL_TYPES::u32 w = 0; w < someWorkers; ++w)
+	{
+		for (HDABatch* aBatch = aSearch.theWorkers[w].theInbox.PopAll(); 0 != aBatch;)
+		{
+			HDABatch* aNextBatch = aBatch->theNext;
+			delete aBatch;
+			aBatch = aNextBatch;
+		}
+		for (std::vector<HDABatch*>::size_type o = 0; o < aSearch.theWorkers[w].theOutboxes.size(); ++o)
+			delete aSearch.theWorkers[w].theOutboxes[o];
+	}
+
+	// Remember the work and the memory of the threads before they vanish
+	theExpansionsPerThread.clear();
+	theSizeOftheWorkers = sizeof(aSearch) + aSearch.theWorkers.capacity() * sizeof(HDAWorker);
+	for (INTERNAL_TYPES::u32 w = 0; w < someWorkers; ++w)
+	{
+		const HDAWorker& aHDAWorker = aSearch.theWorkers[w];
+		theExpansionsPerThread.push_back(aHDAWorker.theExpansions);
+		theSizeOftheWorkers += aHDAWorker.theStates.SizeOf() - sizeof(StateRegistry)
+								+ aHDAWorker.theBestCosts.capacity() * sizeof(PDDL::Number) + aHDAWorker.theEstimates.capacity() * sizeof(PDDL::Number)
+								+ aHDAWorker.theParentWorkers.capacity() * sizeof(INTERNAL_TYPES::u32) + aHDAWorker.theParentStates.capacity() * sizeof(StateRegistry::HState)
+								+ aHDAWorker.theActions.capacity() * sizeof(GroundedAction::HAction) + aHDAWorker.theOutboxes.capacity() * sizeof(HDABatch*)
+								+ aHDAWorker.theApplicableActions.capacity() * sizeof(GroundedAction::HAction) + aHDAWorker.theStack.capacity() * sizeof(SuccessorGenerator::HNode);
+	}
+
+	theExpansions = aSearch.theExpansions.load();
+	if (IsCancelled())
+		theStatus = SEARCH_CANCELLED;
+	else if (aSearch.theBudgetIsSpent.load())
+	{
+		theStatus = SEARCH_BUDGET_EXHAUSTED;
+
+		// The plan found so far, which may not be the cheapest, else the plan to the state, of any thread, missing the fewest predicates of theFinalState
+		INTERNAL_TYPES::u32 aBestWorker = aSearch.theGoalWorker;
+		StateRegistry::HState aBestState = aSearch.theGoalState;
+		if (NO_WORKER == aBestWorker)
+			for (INTERNAL_TYPES::u32 w = 0; w < someWorkers; ++w)
+				for (StateRegistry::HState h = 0; h < aSearch.theWorkers[w].theStates.Size(); ++h)
+				{
+					State someMissingGoals(theFinalState);
+					someMissingGoals.remove(aSearch.theWorkers[w].theStates.GettheState(h));
+					if (someMissingGoals.size() < theMissingGoals)
+					{
+						theMissingGoals = (State::index_type) someMissingGoals.size();
+						aBestWorker = w;
+						aBestState = h;
+					}
+				}
+		else
+			theMissingGoals = 0;
+		if (NO_WORKER != aBestWorker)
+			thePartialPlan = StateSpaceForwardChaining::MaketheHashDistributedPlan(aSearch, aBestWorker, aBestState, theCostOfthePartialPlan);
+	}
+
+	// Tell the user the search space became empty before a solution was found; when the search stopped early, the plan found may not be the cheapest
+	if ((NO_WORKER == aSearch.theGoalWorker) || (SEARCH_COMPLETED != theStatus))
+		return false;
+
+	thePlanFound = StateSpaceForwardChaining::MaketheHashDistributedPlan(aSearch, aSearch.theGoalWorker, aSearch.theGoalState, theCostOfthePlanFound);
+
+	// Tell the user you did a good job!
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::HashDistributedMustStop/2
+//
+// The expansions of all the threads are counted together, but each thread reads the clock and measures
+// its own memory now and then: as the hash values spread the states evenly among the threads, each
+// thread is given an equal share of the memory of theBudget.
+//
+bool StateSpaceForwardChaining::HashDistributedMustStop(HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker) {
+	if (IsCancelled() || aSearch.theBudgetIsSpent.load(std::memory_order_relaxed))
+		return true;
+
+	HDAWorker& aHDAWorker = aSearch.theWorkers[aWorker];
+	bool theBudgetIsSpent = ((0 != theBudget.theExpansions) && (theBudget.theExpansions <= aSearch.theExpansions.load(std::memory_order_relaxed)));
+	if (!theBudgetIsSpent && (aHDAWorker.theNextBudgetCheck <= aHDAWorker.theExpansions) && ((0 != theBudget.theMicroseconds) || (0 != theBudget.theBytes)))
+	{
+		aHDAWorker.theNextBudgetCheck = aHDAWorker.theExpansions + SPHG_BUDGET_CHECK_PERIOD;
+		const size_t aSize = aHDAWorker.theStates.SizeOf() + aHDAWorker.theOpen.size() * sizeof(NodeWithCost)
+							+ aHDAWorker.theStates.Size() * (2 * sizeof(PDDL::Number) + sizeof(INTERNAL_TYPES::u32) + sizeof(StateRegistry::HState) + sizeof(GroundedAction::HAction));
+		theBudgetIsSpent = ((0 != theBudget.theMicroseconds) && (theBudget.theMicroseconds <= (INTERNAL_TYPES::u64) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - theStartTime).count()))
+						|| ((0 != theBudget.theBytes) && (theBudget.theBytes / aSearch.theWorkers.size() <= aSize));
+	}
+
+	if (! theBudgetIsSpent)
+		return false;
+
+	aSearch.theBudgetIsSpent.store(true);
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::MaketheHashDistributedPlan/4
+//
+Plan StateSpaceForwardChaining::MaketheHashDistributedPlan(const HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker, StateRegistry::HState aState, PDDL::Number& aCost) {
+	// Walk up the parents of aState, from thread to thread
+	std::vector<GroundedAction::HAction> someActions;
+	for (INTERNAL_TYPES::u32 w = aWorker, s = aState; NO_WORKER != aSearch.theWorkers[w].theParentWorkers[s];)
+	{
+		const HDAWorker& aHDAWorker = aSearch.theWorkers[w];
+		someActions.push_back(aHDAWorker.theActions[s]);
+		w = aHDAWorker.theParentWorkers[s];
+		s = aHDAWorker.theParentStates[s];
+	}
+	std::reverse(someActions.begin(), someActions.end());
+
+	// Replay the plan from theInitialState so as to store its final state into theStates
+	Operator::HOperatorSignatures anOS;
+	State aFinalState(theStates.GettheState(theInitialState));
+	aCost = 0.0f;
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < someActions.size(); ++a)
+	{
+		const GroundedAction& anAction = theGroundedActions[someActions[a]];
+		anAction.Apply(aFinalState);
+		anOS.push_back(anAction.GettheOperatorSignature());
+		aCost += 1 + anAction.GettheCost();
+	}
+
+	return Plan(theStates.Insert(aFinalState).first, anOS);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::Put/4
+//
+std::ostream& StateSpaceForwardChaining::Put(std::ostream& o, const Plan* aPlan, const std::string& tab, const IterationNumber aCurrentIteration) const {
+	if (aCurrentIteration > 0)
+	{
+		o << "(Plan #" << aCurrentIteration << "):" << std::endl;
+	}
+	else if (&thePartialPlan == aPlan)
+		o << "Partial plan found:" << std::endl;
+	else
+		o << "Solution plan found:" << std::endl;
+
+	// Output the actions in aPlan
+	if (0 == aPlan->Length())
+	{
+		o << tab << "Plan is empty." << std::endl;
+	}
+	else // (0 == aPlan->Length()) but we really mean (0 < aPlan->Length())
+	{
+		const Operator::HOperatorSignatures* theOperatorSignatures = aPlan->GettheOperatorSignatures();
+		for (Operator::HOperatorSignatures::size_type i = 0; i < aPlan->Length(); ++i)
+		{
+			// Compute a pretty printing tab so that actions are aligned on the same column
+			std::string spaces(tab);
+			for(unsigned char ws = 0; ws < (unsigned char)(floor(log10((float) aPlan->Length())) - floor(log10((float) (i + 1)))); ++ws)
+				spaces += " ";
+
+			// 1 action per line:
+			//		action_format	::=	action_identifier "(" parameter-list ")"
+			//		parameter-list	::=	parameter_identifier [ "," parameter-list ]
+			Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
+			o << spaces << (i + 1) << ": " << theIdentifiers[OS[OS.size() - 1]] << "(";
+			for (Operator::HArity a = 0; a < (OS.size() - 1); ++a)
+				if (a == (OS.size() - 2))
+					o << theIdentifiers[OS[a]];
+				else
+					o << theIdentifiers[OS[a]] << ",";
+
+			// Write a ')' at the end of the list of parameters but also when the theOperatorSignatures[i].second.size() is 0 (zero)
+			o << ")" << std::endl;
+		}
+	}
+
+	// Output the state after the application of the last action in aPlan
+	State aResultingState(StateSpaceForwardChaining::GettheResultingState(aPlan));
+	aResultingState.add(theStaticPredicates);
+	o << "The resulting state is {";
+	for (State::index_type i = aResultingState.first(); i < State::end(); i = aResultingState.next(i))
+	{
+		Predicate aPredicate = theSharedPredicates[i];
+		o << theIdentifiers[aPredicate.GettheIdentifier()] << "(";
+		for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
+		{
+			o << theIdentifiers[aPredicate.GettheParameter(a)];
+			if (a < (aPredicate.GettheArity() - 1))
+				 o << ",";
+		}
+
+		if (aResultingState.next(i) < State::end())
+			o << "), ";
+	}
+	o << ")}." << std::endl;
+
+	return o;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::SizeOf/0
+//
+size_t StateSpaceForwardChaining::SizeOf() {
+	// Compute the size of the memory for this StateSpaceForwardChaining search
+
+	size_t s_id = sizeof(theIdentifiers);
+	for (std::vector<PDDL::Identifier>::size_type id = 0; id < theIdentifiers.size(); ++id)
+		s_id += sizeof(theIdentifiers[id]);
+
+	size_t s_sp1 = sizeof(theSharedPredicates);
+	for (PDDL::HPredicate sp = 0; sp < theSharedPredicates.size(); ++sp)
+		s_sp1 += theSharedPredicates[sp].SizeOf();
+
+	size_t s_sp2 = sizeof(theStatesPredicates);
+	for (StatePredicates::iterator it = theStatesPredicates.begin(); it != theStatesPredicates.end(); ++it)
+	{
+		Predicate p = it->first;
+		s_sp2 += p.SizeOf() + sizeof(it->second);
+	}
+
+	size_t s_sos = sizeof(theSharedOperatorSignatures);
+	for (Operator::OperatorSignatures::size_type os1 = 0; os1 < theSharedOperatorSignatures.size(); ++os1)
+	{
+		s_sos += sizeof(theSharedOperatorSignatures[os1]);
+		for (size_t os2 = 0; os2 < theSharedOperatorSignatures[os1].size(); ++os2)
+		{
+			s_sos += sizeof(theSharedOperatorSignatures[os1][os2]);
+		}
+	}
+
+	size_t s_sip = sizeof(theStateIndexedByPredicates) + sizeof(theDynamicIdentifiers) + theDynamicIdentifiers.capacity() * sizeof(Predicate::PredicatesStore::size_type) + sizeof(theStaticPredicates);
+	for (IndexedState::size_type ip1 = 0; ip1 < theStateIndexedByPredicates.size(); ++ip1)
+	{
+		s_sip += sizeof(theStateIndexedByPredicates[ip1]);
+		// We can't add the size of each indexed state because each search node expansion modify this size
+	}
+
+	size_t s_s = theStates.SizeOf() + thePreviousStates.SizeOf();
+
+	size_t s_n = sizeof(theNodes) + theNodes.capacity() * sizeof(SearchNode);
+
+	size_t s_ga = sizeof(theActionsAreGrounded) + sizeof(theGroundedActions) + theGroundedActions.capacity() * sizeof(GroundedAction) + sizeof(theActionsBySignature) + theActionsBySignature.capacity() * sizeof(GroundedAction::HAction) + sizeof(theReachablePredicates) + sizeof(theIrrelevantActions) + sizeof(theIrrelevantPredicates)
+				+ sizeof(theApplicableActions) + theApplicableActions.capacity() * sizeof(GroundedAction::HAction);
+
+	size_t s_sg = theSuccessorGenerator.SizeOf();
+
+	size_t s_ss = theStubbornSets.SizeOf() + sizeof(theStubbornSetsAreUsed);
+
+	size_t s_sy = theSymmetries.SizeOf() + sizeof(theSymmetriesAreUsed);
+
+	size_t s_mg = theMutexGroups.SizeOf() + sizeof(theStatesArePacked) + sizeof(theStatesAreCompressed);
+
+	size_t s_as = sizeof(theOpenWithEstimates) + sizeof(theBestCosts) + theBestCosts.capacity() * sizeof(PDDL::Number) + sizeof(theEstimates) + theEstimates.capacity() * sizeof(PDDL::Number);
+
+	size_t s_dfs = sizeof(theSuccessors) + theSuccessors.capacity() * sizeof(Successors) + sizeof(thePath) + thePath.capacity() * sizeof(const State*)
+				 + sizeof(theChoices) + theChoices.capacity() * sizeof(Successors::size_type) + sizeof(theEndOfthePath) + sizeof(theBound) + sizeof(theNextBound) + theTranspositionTable.SizeOf();
+	for (std::vector<Successors>::size_type d = 0; d < theSuccessors.size(); ++d)
+		s_dfs += theSuccessors[d].capacity() * sizeof(Successor);
+
+	size_t s_pb = sizeof(theBreadthWorkers) + theBreadthWorkers.capacity() * sizeof(BreadthWorker);
+	for (BreadthWorkers::size_type w = 0; w < theBreadthWorkers.size(); ++w)
+		s_pb += theBreadthWorkers[w].theApplicableActions.capacity() * sizeof(GroundedAction::HAction) + theBreadthWorkers[w].theStack.capacity() * sizeof(SuccessorGenerator::HNode)
+				+ theBreadthWorkers[w].theChildren.capacity() * sizeof(BreadthChild);
+
+	size_t s_bd = sizeof(theBackwardNodes) + theBackwardNodes.capacity() * sizeof(BackwardNode) + sizeof(theBackwardOpen) + theBackwardOpen.size() * sizeof(SearchNode::HNode)
+				+ theBackwardRequired.SizeOf() + sizeof(theBackwardNodesByRequired) + theBackwardNodesByRequired.capacity() * sizeof(std::vector<SearchNode::HNode>)
+				+ sizeof(theBackwardNodesByPredicate) + theBackwardNodesByPredicate.capacity() * sizeof(std::vector<SearchNode::HNode>)
+				+ sizeof(theForwardNodes) + theForwardNodes.capacity() * sizeof(SearchNode::HNode) + sizeof(theForwardMeeting) + sizeof(theBackwardMeeting)
+				+ sizeof(theForwardStatesByPredicate) + theForwardStatesByPredicate.capacity() * sizeof(std::vector<StateRegistry::HState>);
+	for (std::vector< std::vector<SearchNode::HNode> >::size_type r = 0; r < theBackwardNodesByRequired.size(); ++r)
+		s_bd += theBackwardNodesByRequired[r].capacity() * sizeof(SearchNode::HNode);
+	for (std::vector< std::vector<SearchNode::HNode> >::size_type p = 0; p < theBackwardNodesByPredicate.size(); ++p)
+		s_bd += theBackwardNodesByPredicate[p].capacity() * sizeof(SearchNode::HNode);
+	for (std::vector< std::vector<StateRegistry::HState> >::size_type p = 0; p < theForwardStatesByPredicate.size(); ++p)
+		s_bd += theForwardStatesByPredicate[p].capacity() * sizeof(StateRegistry::HState);
+
+	size_t s_gs = sizeof(thePreferredOpenWithCosts) + sizeof(theExpandedStates) + theExpandedStates.capacity() / 8 + sizeof(theBestEstimate) + sizeof(theRegularPriority) + sizeof(thePreferredPriority);
+
+	std::cout	<< std::endl
+				<< "Memory consumption for this state space forward chaining search:" << std::endl
+				<< "   - " << theIdentifiers.size() << " identifiers for " << s_id << " bytes." << std::endl
+				<< "   - " << theSharedPredicates.size() << " predicates for " << s_sp1 << " bytes." << std::endl
+				<< "   - " << (unsigned int) theStaticPredicates.size() << " static predicates, kept out of the states." << std::endl
+				<< "   - " << theStates.Size() << " states for " << s_s << " bytes";
+	if (theStates.IsCompressed() && !theExpansionsPerThread.empty())
+		std::cout << ": the states of the threads are not stored as deltas, as their parents belong to other threads";
+	else if (theStates.IsCompressed())
+		std::cout << ": a state is stored as a delta to its parent, with a full state at least every " << theStates.GettheCheckpointPeriod() << " states";
+	std::cout	<< "." << std::endl
+				<< "   - " << theNodes.size() << " search nodes for " << s_n << " bytes." << std::endl
+				<< "   - " << theSharedOperatorSignatures.size() << " operator signatures for " << s_sos << " bytes." << std::endl;
+	if (theActionsAreGrounded)
+	{
+		std::cout << "   - " << theGroundedActions.size() << " grounded actions for " << s_ga << " bytes." << std::endl;
+		if (0 != theIrrelevantActions)
+			std::cout << "   - " << theIrrelevantActions << " grounded actions pruned: " << theIrrelevantPredicates << " reachable predicates are irrelevant to the goal." << std::endl;
+		std::cout << "   - " << theSuccessorGenerator.Size() << " successor generator nodes for " << s_sg << " bytes." << std::endl;
+		if (theStubbornSetsAreUsed)
+			std::cout << "   - stubborn sets for " << s_ss << " bytes." << std::endl;
+		if (theSymmetriesAreUsed)
+			std::cout << "   - " << theSymmetries.GettheNumberOfGenerators() << " object symmetries for " << s_sy << " bytes." << std::endl;
+		std::cout << "   - " << theMutexGroups.GettheNumberOfVariables() << " mutex groups for " << s_mg << " bytes";
+		if (theStates.IsPacked())
+			std::cout << ": a state is packed in " << theMutexGroups.GettheNumberOfWords() * sizeof(MutexGroups::Word) << " bytes instead of " << sizeof(State);
+		std::cout << "." << std::endl;
+	}
+
+	return (+ sizeof(theDomain)
+			+ sizeof(theProblem)
+			+ sizeof(theRegistration)
+			+ sizeof(theSizeOftheSharedPredicates)
+			+ sizeof(theInitialState)
+			+ sizeof(theFinalState)
+			+ thePlanFound.SizeOf()
+			+ sizeof(theCostOfthePlanFound)
+			+ sizeof(theBudget) + sizeof(theStatus) + sizeof(theExpansions) + sizeof(theNextBudgetCheck) + sizeof(theStartTime)
+			+ thePartialPlan.SizeOf() + sizeof(theCostOfthePartialPlan) + sizeof(theMissingGoals)
+			+ sizeof(theStartedSearch) + sizeof(theStartedHeuristic)
+			+ s_open_Max	// == 0 when (memory_consumption_is_measured == false)
+			+ s_id
+			+ s_sp1
+			+ s_sp2
+			+ s_sos
+			+ s_sip
+			+ s_s
+			+ s_n
+			+ s_ga
+			+ s_sg
+			+ s_ss
+			+ s_sy
+			+ s_mg
+			+ s_as
+			+ s_gs
+			+ s_dfs
+			+ s_bd
+			+ s_pb
+			+ sizeof(theExpansionsPerThread) + theExpansionsPerThread.capacity() * sizeof(INTERNAL_TYPES::u32) + sizeof(theSizeOftheWorkers) + theSizeOftheWorkers
+);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ConvertthePlanFound/0
+//
+EXTERNAL_TYPES::op_str* StateSpaceForwardChaining::ConvertthePlanFound() const {
+
+	// The linked list which shall contain thePlanFound
+	EXTERNAL_TYPES::op_str* PlanFound = new EXTERNAL_TYPES::op_str;	// op_str default constructor sets arity to 0 (== the linked list contains a solution)
+
+	// Begin with a fake element which contains the plan length, i.e. the number of elements in the linked list
+	PlanFound->arg_name[0] = (char*) thePlanFound.Length();	// Length/0 return a size_t; hopefully, a plan length should be strictly less than 128
+
+	EXTERNAL_TYPES::op_str* p = PlanFound;
+	const Operator::HOperatorSignatures* theOperatorSignatures = thePlanFound.GettheOperatorSignatures();
+	for (Plan::length_type i = 0; i < thePlanFound.Length(); ++i)
+	{
+		// Get some heap space for the next operator in the plan and point to this new store
+		p->op_next = new EXTERNAL_TYPES::op_str;
+		p = p->op_next;
+
+		// Get the internal structure (the OperatorSignature) and convert it to the op_str* linked list
+		Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
+		p->arity = (int) (1 + OS.size());	// theIdentifier of the Operator PLUS theParameters of the Operator
+
+		// Put the Operator identifier in arg_name[0]
+		// First, get some heap space for the string of characters PLUS 1 space for marking the end of the string
+		PDDL::HIdentifier action_identifier = OS[OS.size() - 1];
+		p->arg_name[0] = (char*) malloc(1 + theIdentifiers[action_identifier].size());
+		for (unsigned char c = 0; c < theIdentifiers[action_identifier].size(); ++c)
+			p->arg_name[0][c] = theIdentifiers[action_identifier].c_str()[c];
+		// Mark the end of the string of characters
+		p->arg_name[0][theIdentifiers[action_identifier].size()] = '\0';
+
+		// Put the Operator parameters from arg_name[1] to arg_name[arity - 1]
+		for (Operator::HArity a = 0; (a < MAX_ARGS_OP && a < p->arity); ++a)
+		{
+			// First, get space for the string of characters PLUS 1 space for marking the end of the string
+			p->arg_name[a] = (char*) malloc(1 + theIdentifiers[OS[a]].size());
+			for (unsigned char c = 0; c < theIdentifiers[OS[a]].size(); ++c)
+				p->arg_name[a][c] = theIdentifiers[OS[a]].c_str()[c];
+			// Mark the end of the string of characters
+			p->arg_name[a][theIdentifiers[OS[a]].size()] = '\0';
+		}
+	}
+
+	return PlanFound;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ConvertthePlanFound/1
+//
+void StateSpaceForwardChaining::ConvertthePlanFound(EXTERNAL_TYPES::plan& aPlan) const {
+
+	const Operator::HOperatorSignatures* theOperatorSignatures = thePlanFound.GettheOperatorSignatures();
+	for (Plan::length_type i = 0; i < thePlanFound.Length(); ++i)
+	{
+		Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
+
+		EXTERNAL_TYPES::op op_i;
+		op_i.first = theIdentifiers[OS[OS.size() - 1]];
+
+		for (Operator::HArity a = 0; a < (OS.size() - 1); ++a)
+			op_i.second.push_back(theIdentifiers[OS[a]]);
+
+		aPlan.push_back(op_i);
+	}
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StateSpaceForwardChaining::ConvertthePlanFoundToString/0
+//
+std::string StateSpaceForwardChaining::ConvertthePlanFoundToString() const {
+	std::string buffer = "";
+
+	const Operator::HOperatorSignatures* theOperatorSignatures = thePlanFound.GettheOperatorSignatures();
+	for (Plan::length_type i = 0; i < thePlanFound.Length(); ++i)
+	{
+		Operator::OperatorSignature OS = theSharedOperatorSignatures[(*theOperatorSignatures)[i]];
+
+		buffer += theIdentifiers[OS[OS.size()]];
+		buffer += "(";
+
+		for (Operator::HArity a = 0; a < (OS.size() - 1); ++a)
+		{
+			buffer += theIdentifiers[OS[a]];
+			if (a < (OS.size() - 2))
+				buffer += ",";
+			else // (a >= (OS.size() - 2))
+			{
+				if (i < (thePlanFound.Length() - 1))
+					buffer += ");";
+				else // (i == (thePlanFound.Length() - 1)
+					buffer += ").";
+			}
+		}
+	}
+
+	return buffer;
+}
+
 // ================================================================================================ End of file "StateSpaceForwardChaining.cpp"
\ No newline at end of file
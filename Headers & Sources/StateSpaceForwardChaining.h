@@ -1,206 +1,569 @@
-// ================================================================================================ Beginning of file "StateSpaceForwardChaining.h"
-// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
-// ------------------------------------------------------------------------------------------------
-#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
-#define _SPHG_PLANNER_SEARCH_SSFC_H
-
-#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
-	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler 
-#endif					// _MSC_VER
-
-// ------------------------------------------------------------------------------------------------ Inclusion of files
-// STD and STL files
-#include <deque>		// STL Store house for the plans waiting to be expanded
-#include <functional>	// Less binary_function between two Plans with respect to their costs
-#include <iostream>		// Writing a plan out on a stream
-#include <queue>		// STL Store house for the plans with their costs, waiting to be expanded
-#include <vector>		// STL Store house for various structures (Identifiers, Predicates, etc)
-
-// Project files
-#ifndef _EXTERNAL_TYPES_H
-	#include "ExternalTypes.h"
-#endif
-
-#ifndef _INTERNAL_TYPES_H
-	#include "InternalTypes.h"			// Visibility for u32
-#endif
-
-#ifndef _SPHG_PDDL_DOMAIN_H
-	#include "Domain.h"
-#endif
-
-#ifndef _SPHG_PLANNER_PLAN_H
-	#include "Plan.h"
-#endif
-
-#ifndef _SPHG_PLANNER_PREDICATE_H
-	#include "Predicate.h"
-#endif
-
-#ifndef _SPHG_SEARCH_FACADE_H
-	#include "Search.h"					// Visibility for Search
-#endif
-
-#ifndef _SPHG_PLANNER_STATES_H
-	#include "States.h"
-#endif
-
-// Memory heat maps purposes
-//#include <fstream>
-//#include "Runtimes.h"
-
-// ------------------------------------------------------------------------------------------------ Class definition
-class StateSpaceForwardChaining : Search {
-	// ----- Types
-	public:
-		typedef		std::map<Predicate, PDDL::HPredicate>	StatePredicates;		// Allowing a fast answer to: What's the integer pointer to this Predicate?
-		typedef		INTERNAL_TYPES::u32						IterationNumber;		// Number of search iterations
-		typedef		INTERNAL_TYPES::u32						size_type;				// Total memory used by one search
-
-	private:
-		typedef		std::deque<Plan>						SearchFrontier;			// Plans waiting to be processed by BreadthExpand/0
-
-		typedef		std::pair<PDDL::Number, Plan>			PlanWithCost;			// A Plan and its floating point cost
-		struct Greater_PlanWithCost : public std::binary_function<PlanWithCost, PlanWithCost, bool> {	// Has the left plan a greater cost than the right plan?
-			bool operator() (const PlanWithCost& left, const PlanWithCost& right) const {
-				return (left.first > right.first);
-			}
-		};
-		typedef		std::priority_queue<PlanWithCost, std::vector<PlanWithCost>, Greater_PlanWithCost>		SearchFrontierWithCosts;	// Plans and their costs waiting to be processed by CostExpand/0; its top() plan has the lowest cost of all plans
-
-
-	// ----- Properties
-	private:
-		Domain*										theDomain;						// An access to the PDDL Domain constants, predicates and actions for the search
-		Domain::HProblem							theProblem;						// The PDDL Problem (accessed through theDomain) owning this StateSpaceForwardChaining search
-		PDDL::HPredicate							theSizeOftheSharedPredicates;	// Computed before search in order to re-initialize future searches
-
-		States::iterator							theInitialState;				// An access to the Initial State in theStates
-		States::iterator							theFinalState;					// An access to the Final State in theStates
-
-		Plan										thePlanFound;					// A solution plan found by this StateSpaceForwardChaining
-		PDDL::Number								theCostOfthePlanFound;			// A solution plan found by this StateSpaceForwardChaining
-
-		StateSpaceForwardChaining::size_type		s_open_Max;						// [0, 2^32 - 1 = 4294967295] Maximum number of bytes used to store theOpen, over all search iterations
-		SearchFrontier								theOpen;						// The StateSpaceForwardChaining Frontier (i.e. the queue of nodes yet to be expanded by this StateSpaceForwardChaining)
-		SearchFrontierWithCosts						theOpenWithCosts;				// The StateSpaceForwardChaining Frontier (i.e. the priority queue of nodes and their costs, yet to be expanded by this StateSpaceForwardChaining)
-
-																					// std::vectors
-		std::vector<PDDL::Identifier>				theIdentifiers;					// The union of the constants of the domain and the constants of a problem
-		std::vector<Predicate>						theSharedPredicates;			// In order to be shared among all states of the StateSpaceForwardChaining, thePredicates of theDomain must be globals to the StateSpaceForwardChaining
-		Operator::OperatorSignatures				theSharedOperatorSignatures;	// In order to be shared among all plans of the search frontier, OperatorSignatures must be globals to the StateSpace ForwardChaining
-		IndexedState								theStateIndexedByPredicates;	// Index the predicates of a state in an array; make the index the identifier of the predicates for a very quick access
-
-																					// std::maps
-		StateSpaceForwardChaining::StatePredicates	theStatesPredicates;			// Predicates, instantiated during search, pointing to positions in theSharedPredicates
-		States										theStates;						// Used to check whether a state computed from the application of an operator has already been computed
-
-
-		//SPHG::Runtimes_hrc R;
-		//std::string s;
-		//std::ofstream of;
-
-	// ----- Constructor
-	public:
-		StateSpaceForwardChaining(Domain& aDomain, Domain::HProblem aProblem);
-
-
-	// ----- Destructor
-	public:
-		~StateSpaceForwardChaining();
-
-
-	// ----- Accessors
-	public:
-		inline Predicate& GetthePredicate(PDDL::HPredicate aPredicate) { return theSharedPredicates[aPredicate]; }
-		inline Predicate MakeCopyOfthePredicate(PDDL::HPredicate aPredicate) const { return theSharedPredicates[aPredicate]; }
-		inline PDDL::HPredicate AddPredicate(const Predicate& aPredicate) {
-			PDDL::HPredicate p = (PDDL::HPredicate) theSharedPredicates.size();
-			theSharedPredicates.push_back(aPredicate);
-			return p;
-		}
-		inline std::pair<States::iterator, bool> Insert(State& aState, Plan::length_type aPlanLength) {
-			// BreadthExpand/0 does not call Insert/2 because aPlanLength always increases during state-space breadth-first search
-			States::iterator it = theStates.find(aState);
-			if (theStates.end() == it)
-			{
-				return theStates.insert(std::pair<State, Plan::length_type>(aState, aPlanLength));
-			}
-			else // (theStates.end() != it)
-			{
-				// ((it->second) <= aPlanLength) always true when breadth-first searching
-				if ((it->second) > aPlanLength)
-				{
-					it->second = aPlanLength;
-					return std::pair<States::iterator, bool>(it, true);
-				}
-				else // ((it->second) <= aPlanLength)
-					return std::pair<States::iterator, bool>(it, false);
-			}
-		}
-		inline StateSpaceForwardChaining::StatePredicates::const_iterator Find(const Predicate& aPredicate) const {
-			return (theStatesPredicates.find(aPredicate));
-		}
-		inline bool Found(StateSpaceForwardChaining::StatePredicates::const_iterator it) const {
-			return (theStatesPredicates.end() != it);
-		}
-		inline PDDL::HPredicate InsertAsSharedPredicate(const Predicate& aPredicate) {
-			StateSpaceForwardChaining::StatePredicates::const_iterator it = theStatesPredicates.find(aPredicate);
-			if (theStatesPredicates.end() == it)
-			{
-				PDDL::HPredicate p = StateSpaceForwardChaining::AddPredicate(aPredicate);
-				theStatesPredicates[aPredicate] = p;
-				return p;
-			}
-			else // (theStatesPredicates.end() != it)
-				return (it->second);
-		}
-		inline Operator::HOperatorSignature AddOperatorSignature(Operator::OperatorSignature& anOperatorSignature) {
-			Operator::HOperatorSignature p = theSharedOperatorSignatures.size();
-			theSharedOperatorSignatures.push_back(anOperatorSignature);
-			return p;
-		}
-		inline const Plan* GetthePlanFound() const { return &thePlanFound; }
-
-
-	// ----- Operations
-	private:
-#if (STL == MEMORY_ALLOCATION)
-		State Apply(const State& aCurrentState, const Operator* Op, Operator::Predicates& D, PDDL::Parameters P);
-		bool UnifyPreconditions(const Operator* Op, Operator::Predicates& D, PDDL::Parameters P, IndexedState& aMappedCurrentState);
-#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
-		State Apply(const State& aCurrentState, const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P);
-		bool UnifyPreconditions(const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P, IndexedState& aMappedCurrentState);
-#else
-	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
-	#error MEMORY_ALLOCATION
-#endif
-
-		bool CostExpand();		// Expanding the cheapest node from the search frontier and adding its costy children to it
-
-		bool BreadthExpand();	// Expanding a node and adding its children to the search frontier in a breadth first manner
-
-	public:
-		size_t SizeOf();
-
-		void Reset();			// Re-initialize data before a new search for the same problem
-
-		bool BreadthFirst(bool memory_consumption_is_measured = false /* default is: memory usage is NOT measured */);	// Breadth first search of the state space
-
-		bool BestFirst();		// Cheapest-action-cost-first search of the state space
-
-		std::ostream& Put(std::ostream& o, const Plan* aPlan, const std::string& tab, const IterationNumber aCurrentIteration = 0) const;
-
-
-	// ----- Interface Operations
-	public:
-		EXTERNAL_TYPES::op_str* ConvertthePlanFound() const;
-		void ConvertthePlanFound(EXTERNAL_TYPES::plan& aPlan /* shall contain the result of the conversion */) const;
-
-		// The returned std::string contains the plans as follows: "action_id_1(param_id_11,...,param_id_1n);action_id_2(param_id_21,...,param_id_2n); ... ; action_id_n(param_id_n1,...,param_id_nn)."
-		std::string ConvertthePlanFoundToString() const;
-
-};
-
-#endif	// _SPHG_PLANNER_SEARCH_SSFC_H
-// ================================================================================================ End of file "StateSpaceForwardChaining.h"
+// ================================================================================================ Beginning of file "StateSpaceForwardChaining.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+#define _SPHG_PLANNER_SEARCH_SSFC_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler 
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <atomic>		// Visibility for std::atomic
+#include <chrono>		// Visibility for std::chrono::steady_clock
+#include <deque>		// STL Store house for the nodes waiting to be expanded
+#include <functional>	// Less binary_function between two nodes with respect to their costs
+#include <iostream>		// Writing a plan out on a stream
+#include <mutex>		// Visibility for std::mutex
+#include <queue>		// STL Store house for the nodes with their costs, waiting to be expanded
+#include <vector>		// STL Store house for various structures (Identifiers, Predicates, etc)
+
+// Project files
+#ifndef _EXTERNAL_TYPES_H
+	#include "ExternalTypes.h"
+#endif
+
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_H
+	#include "Domain.h"
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_SNAPSHOT_H
+	#include "DomainSnapshot.h"			// Visibility for DomainSnapshot and DomainSnapshot::FrozenProblem
+#endif
+
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+	#include "GroundedAction.h"
+#endif
+
+#ifndef _SPHG_PLANNER_HEURISTIC_H
+	#include "Heuristic.h"				// Visibility for Heuristic
+#endif
+
+#ifndef _SPHG_PLANNER_MESSAGE_QUEUE_H
+	#include "MessageQueue.h"			// Visibility for MessageQueue
+#endif
+
+#ifndef _SPHG_PLANNER_PLAN_H
+	#include "Plan.h"
+#endif
+
+#ifndef _SPHG_PLANNER_PREDICATE_H
+	#include "Predicate.h"
+#endif
+
+#ifndef _SPHG_SEARCH_FACADE_H
+	#include "Search.h"					// Visibility for Search
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_NODE_H
+	#include "SearchNode.h"
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"
+#endif
+
+#ifndef _SPHG_PLANNER_STATE_REGISTRY_H
+	#include "StateRegistry.h"
+#endif
+
+#ifndef _SPHG_PLANNER_SUCCESSOR_GENERATOR_H
+	#include "SuccessorGenerator.h"
+#endif
+
+#ifndef _SPHG_PLANNER_MUTEX_GROUPS_H
+	#include "MutexGroups.h"			// Visibility for MutexGroups
+#endif
+
+#ifndef _SPHG_PLANNER_STUBBORN_SETS_H
+	#include "StubbornSets.h"			// Visibility for StubbornSets
+#endif
+
+#ifndef _SPHG_PLANNER_SYMMETRIES_H
+	#include "Symmetries.h"				// Visibility for Symmetries
+#endif
+
+#ifndef _SPHG_PLANNER_TRANSPOSITION_TABLE_H
+	#include "TranspositionTable.h"
+#endif
+
+// Memory heat maps purposes
+//#include <fstream>
+//#include "Runtimes.h"
+
+// ------------------------------------------------------------------------------------------------ Class definition
+class StateSpaceForwardChaining : Search {
+	// ----- Types
+	public:
+		typedef		std::map<Predicate, PDDL::HPredicate>	StatePredicates;		// Allowing a fast answer to: What's the integer pointer to this Predicate?
+		typedef		INTERNAL_TYPES::u32						IterationNumber;		// Number of search iterations
+		typedef		INTERNAL_TYPES::u32						size_type;				// Total memory used by one search
+
+		struct Budget {											// The limits of a search (cf. SetBudget/1); 0 means no limit
+			INTERNAL_TYPES::u32				theExpansions;		// The number of nodes expanded
+			INTERNAL_TYPES::u64				theMicroseconds;	// The wall clock time since the search started
+			size_t							theBytes;			// The memory of the states, nodes and frontiers of the search
+			Budget() : theExpansions(0), theMicroseconds(0), theBytes(0) {}
+		};
+
+		enum SearchStatus : INTERNAL_TYPES::u8 {				// Why the last search stopped (cf. GettheStatus/0)
+			SEARCH_COMPLETED,									// A plan was found, or there was nothing left to expand
+			SEARCH_BUDGET_EXHAUSTED,							// theBudget was spent first: GetthePartialPlan/0 leads to the state closest to the goal
+			SEARCH_CANCELLED,									// theCancellation was set first
+			SEARCH_IN_PROGRESS,									// Step/1 or RunFor/1 returned before the started search ended: call them again
+			SEARCH_NEEDS_RESTART								// Replan/2 cannot repair the plan: theInitialState is unchanged, search the changed problem with a new StateSpaceForwardChaining
+		};
+
+	private:
+		typedef		std::deque<SearchNode::HNode>			SearchFrontier;			// Nodes waiting to be processed by BreadthExpand/0
+
+		enum StartedSearch : INTERNAL_TYPES::u8 {				// The search prepared by a Start.../N operation, which Step/1 and RunFor/1 go on with
+			NO_STARTED_SEARCH,
+			STARTED_BREADTH_FIRST,
+			STARTED_BEST_FIRST,
+			STARTED_ASTAR,
+			STARTED_GREEDY_BEST_FIRST
+		};
+
+		typedef		std::pair<PDDL::Number, SearchNode::HNode>	NodeWithCost;		// A node and the floating point cost of the plan leading to it
+		struct Greater_NodeWithCost : public std::binary_function<NodeWithCost, NodeWithCost, bool> {	// Has the left node a greater cost than the right node?
+			bool operator() (const NodeWithCost& left, const NodeWithCost& right) const {
+				return (left.first > right.first);
+			}
+		};
+		typedef		std::priority_queue<NodeWithCost, std::vector<NodeWithCost>, Greater_NodeWithCost>		SearchFrontierWithCosts;	// Nodes and their costs waiting to be processed by CostExpand/0; its top() node has the lowest cost of all nodes
+
+		struct NodeWithEstimate {								// A node, the cost of the plan leading to it plus the estimate of the cost to the goal, and this estimate alone
+			PDDL::Number		theEstimatedCost;
+			PDDL::Number		theEstimate;
+			SearchNode::HNode	theNode;
+			NodeWithEstimate(PDDL::Number anEstimatedCost, PDDL::Number anEstimate, SearchNode::HNode aNode) : theEstimatedCost(anEstimatedCost), theEstimate(anEstimate), theNode(aNode) {}
+		};
+		struct Greater_NodeWithEstimate : public std::binary_function<NodeWithEstimate, NodeWithEstimate, bool> {	// Has the left node a greater estimated cost than the right node? Break ties with the estimates alone
+			bool operator() (const NodeWithEstimate& left, const NodeWithEstimate& right) const {
+				return ((left.theEstimatedCost > right.theEstimatedCost) || ((left.theEstimatedCost == right.theEstimatedCost) && (left.theEstimate > right.theEstimate)));
+			}
+		};
+		typedef		std::priority_queue<NodeWithEstimate, std::vector<NodeWithEstimate>, Greater_NodeWithEstimate>	SearchFrontierWithEstimates;	// Nodes waiting to be processed by AStarExpand/1; its top() node has the lowest estimated cost of all nodes
+
+		struct Successor {										// A child state, the operator signature which produced it and the cost of this operator, for IterativeDeepening/1
+			State							theState;
+			Operator::OperatorSignature		theOperatorSignature;
+			PDDL::Number					theCost;
+		};
+		typedef		std::vector<Successor>					Successors;				// All the children of a state, in the order BreadthExpand/0 would compute them
+
+#if (STL == MEMORY_ALLOCATION)
+		typedef		Operator::Parameters&					LiftedParameters;		// The values of the parameters of a domain operator unified with a state (cf. ApplytheOperators/2)
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+		typedef		PDDL::Parameters						LiftedParameters;		// The values of the parameters of a domain operator unified with a state (cf. ApplytheOperators/2)
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+		typedef		bool (StateSpaceForwardChaining::*LiftedChild)(const Operator*, Domain::HOperator, LiftedParameters, const State&);	// What to do with a child of ApplytheOperators/2; true stops the expansion
+
+		struct BackwardNode {									// A node of the backward search of Bidirectional/0: from any state including theRequired and excluding theForbidden,
+			State							theRequired;		// applying the grounded action of this node, then the grounded actions of its parents, reaches theFinalState
+			State							theForbidden;
+			SearchNode::HNode				theParent;			// SearchNode::NO_NODE for the root node, i.e. theFinalState
+			GroundedAction::HAction			theAction;			// The grounded action regressed from the parent node
+			PDDL::Number					theCost;			// The length of the plan from this node to theFinalState
+		};
+		typedef		std::vector<BackwardNode>				BackwardNodes;			// All the nodes generated by the backward search of Bidirectional/0
+
+		struct BreadthChild {									// A child generated by a thread of ParallelBreadthFirst/1, waiting to be merged into theStates and theNodes
+			State							theState;
+			SearchNode::HNode				theParent;
+			GroundedAction::HAction			theAction;
+			bool							theGoalIsReached;	// Is theFinalState included in theState?
+		};
+		struct BreadthWorker {									// Everything a thread of ParallelBreadthFirst/1 writes to while expanding its part of a layer
+			SearchFrontier::size_type		theFirstNode;		// This thread expands the nodes of theOpen in the range [theFirstNode, theLastNode)
+			SearchFrontier::size_type		theLastNode;
+			std::vector<GroundedAction::HAction>		theApplicableActions;
+			std::vector<SuccessorGenerator::HNode>		theStack;			// The stack of theSuccessorGenerator
+			StubbornSets::Scratch			theStubbornScratch;	// The scratch of theStubbornSets
+			std::vector<BreadthChild>		theChildren;		// The children not in theStates, in the order GroundedBreadthExpand/0 would compute them
+		};
+		typedef		std::vector<BreadthWorker>				BreadthWorkers;
+
+		static const INTERNAL_TYPES::u32 NO_WORKER = 0xFFFFFFFF;				// The parent worker of theInitialState in HashDistributedAStar/1
+		struct HDAMessage {										// A child sent by a thread of HashDistributedAStar/1 to the thread owning its state
+			State							theState;
+			StateRegistry::HashValue		theHashValue;		// StateRegistry::Hash(theState); its high 32 bits choose the owner of theState
+			PDDL::Number					theCost;			// The cost of the plan reaching theState
+			INTERNAL_TYPES::u32				theParentWorker;	// The owner of the parent state; NO_WORKER for theInitialState
+			StateRegistry::HState			theParentState;		// The parent state, in the registry of theParentWorker
+			GroundedAction::HAction			theAction;			// The grounded action applied to the parent state
+		};
+		struct HDABatch {										// The messages sent at once by a thread to another
+			std::vector<HDAMessage>			theMessages;
+			HDABatch*						theNext;			// Links the batches in the MessageQueue of the receiving thread
+		};
+		struct HDAWorker {										// A thread of HashDistributedAStar/1 and the partition of the state space it owns
+			StateRegistry							theStates;			// The states owned by this thread; an HState is only meaningful with the number of its owner
+			std::vector<PDDL::Number>				theBestCosts;		// For each state of theStates, the cost of the cheapest plan received so far...
+			std::vector<PDDL::Number>				theEstimates;		// ... its estimate, computed once when it is received for the first time...
+			std::vector<INTERNAL_TYPES::u32>		theParentWorkers;	// ... and the parent state and the grounded action of this cheapest plan
+			std::vector<StateRegistry::HState>		theParentStates;
+			std::vector<GroundedAction::HAction>	theActions;
+			SearchFrontierWithCosts					theOpen;			// The states of theStates with their cost plus estimate, waiting to be expanded
+			MessageQueue<HDABatch>					theInbox;			// The batches sent to this thread
+			std::vector<HDABatch*>					theOutboxes;		// The batches this thread fills for every other thread
+			Heuristic*								theHeuristic;		// This thread evaluates the states it owns; 0 when the estimates are all 0
+			std::vector<GroundedAction::HAction>	theApplicableActions;
+			std::vector<SuccessorGenerator::HNode>	theStack;			// The stack of theSuccessorGenerator
+			StubbornSets::Scratch					theStubbornScratch;	// The scratch of theStubbornSets
+			INTERNAL_TYPES::u32						theExpansions;
+			INTERNAL_TYPES::u32						theNextBudgetCheck;	// The clock and the memory of this thread are read when theExpansions reaches it
+		};
+		struct HDASearch {										// What the threads of HashDistributedAStar/1 share
+			std::vector<HDAWorker>			theWorkers;
+			std::atomic<long>				theWork;			// The number of busy threads plus the number of batches not received yet: the search is over at 0
+			std::atomic<INTERNAL_TYPES::u32>	theExpansions;		// The expansions of all the threads, counted against theBudget
+			std::atomic<bool>				theBudgetIsSpent;	// Set by the first thread to find theBudget spent; all the threads then stop
+			std::atomic<PDDL::Number>		theIncumbentCost;	// The cost of the cheapest plan to theFinalState found so far; Heuristic::DEAD_END when none
+			std::mutex						theIncumbentMutex;	// Protects the update of theIncumbentCost, theGoalWorker and theGoalState
+			INTERNAL_TYPES::u32				theGoalWorker;		// The owner of...
+			StateRegistry::HState			theGoalState;		// ... the last state of the cheapest plan found so far
+			explicit HDASearch(std::vector<HDAWorker>::size_type someWorkers) : theWorkers(someWorkers), theWork(0), theExpansions(0), theBudgetIsSpent(false), theIncumbentCost(Heuristic::DEAD_END), theGoalWorker(NO_WORKER), theGoalState(StateRegistry::NO_STATE) {}
+		};
+
+
+	// ----- Properties
+	private:
+		const Domain*								theDomain;						// An access to the PDDL Domain constants, predicates and actions for the search; only read
+		Domain::HProblem							theProblem;						// The PDDL Problem (accessed through theDomain) owning this StateSpaceForwardChaining search
+		Problem*									theRegistration;				// The PDDL Problem this search registered with; 0 when built on a DomainSnapshot
+		PDDL::HPredicate							theSizeOftheSharedPredicates;	// Computed before search in order to re-initialize future searches
+
+		StateRegistry::HState						theInitialState;				// An access to the Initial State in theStates
+		State										theFinalState;					// The Final State is not stored in theStates: a state equal to the goal must remain reachable
+
+		Plan										thePlanFound;					// A solution plan found by this StateSpaceForwardChaining
+		PDDL::Number								theCostOfthePlanFound;			// A solution plan found by this StateSpaceForwardChaining
+
+		StateSpaceForwardChaining::size_type		s_open_Max;						// [0, 2^32 - 1 = 4294967295] Maximum number of bytes used to store theOpen, over all search iterations
+		SearchFrontier								theOpen;						// The StateSpaceForwardChaining Frontier (i.e. the queue of nodes yet to be expanded by this StateSpaceForwardChaining)
+		SearchNodes									theNodes;						// All the nodes generated by this StateSpaceForwardChaining; theOpen and theOpenWithCosts point to positions in theNodes
+		SearchFrontierWithCosts						theOpenWithCosts;				// The StateSpaceForwardChaining Frontier (i.e. the priority queue of nodes and their costs, yet to be expanded by this StateSpaceForwardChaining)
+		SearchFrontierWithEstimates					theOpenWithEstimates;			// The AStar/1 Frontier (i.e. the priority queue of nodes and their estimated costs, yet to be expanded by AStar/1)
+		std::vector<PDDL::Number>					theBestCosts;					// AStar/1: the cost of the cheapest plan found so far to each state of theStates
+		std::vector<PDDL::Number>					theEstimates;					// AStar/1: the heuristic estimate of each state of theStates, computed once
+		SearchFrontierWithCosts						thePreferredOpenWithCosts;		// GreedyBestFirst/1: the nodes reached with a preferred action, with the estimate of their parent; theOpenWithCosts holds all the nodes
+		std::vector<bool>							theExpandedStates;				// GreedyBestFirst/1: the states of theStates which have been evaluated and expanded
+		PDDL::Number								theBestEstimate;				// GreedyBestFirst/1: the lowest estimate evaluated so far
+		long										theRegularPriority;				// GreedyBestFirst/1: the queue with the lowest priority is expanded next;
+		long										thePreferredPriority;			// each expansion raises the priority of its queue and progress lowers the priority of thePreferredOpenWithCosts
+
+																					// Iterative deepening (cf. IterativeDeepening/1)
+		std::vector<Successors>						theSuccessors;					// The children of the states along thePath, one Successors per depth
+		std::vector<const State*>					thePath;						// The states from theInitialState to the state being expanded; they are in theStates (theInitialState) or in theSuccessors
+		std::vector<Successors::size_type>			theChoices;						// thePath[d + 1] is theSuccessors[d][theChoices[d]]
+		State										theEndOfthePath;				// The state reached by the plans made from thePath, kept out of theStates: these plans have no state (cf. GettheResultingState/1)
+		PDDL::Number								theBound;						// No plan whose cost plus estimate is greater than theBound is expanded during the current iteration
+		PDDL::Number								theNextBound;					// The lowest cost plus estimate greater than theBound met during the current iteration
+		TranspositionTable							theTranspositionTable;			// The states already reached during the current iteration, as many as fit in a fixed size table
+
+																					// Bidirectional search (cf. Bidirectional/0); the forward search uses theNodes, theOpen and theStates
+		BackwardNodes								theBackwardNodes;				// All the nodes generated by the backward search
+		SearchFrontier								theBackwardOpen;				// The backward search frontier
+		StateRegistry								theBackwardRequired;			// The different theRequired of theBackwardNodes...
+		std::vector< std::vector<SearchNode::HNode> >	theBackwardNodesByRequired;	// ... and, for each of them, theBackwardNodes with these required predicates
+		std::vector< std::vector<SearchNode::HNode> >	theBackwardNodesByPredicate;	// theBackwardNodes indexed by their lowest required predicate; State::end() when they require none
+		std::vector<SearchNode::HNode>				theForwardNodes;				// The node of theNodes which reached each state of theStates
+		std::vector< std::vector<StateRegistry::HState> >	theForwardStatesByPredicate;	// The states of theStates indexed by each of their predicates; State::end() indexes them all
+		SearchNode::HNode							theForwardMeeting;				// The forward node and...
+		SearchNode::HNode							theBackwardMeeting;				// ... the backward node of the shortest plan found so far
+
+																					// Parallel breadth first search (cf. ParallelBreadthFirst/1)
+		BreadthWorkers								theBreadthWorkers;				// One per thread
+
+																					// Hash distributed A* (cf. HashDistributedAStar/1); the threads and their states only live during the search
+		std::vector<INTERNAL_TYPES::u32>			theExpansionsPerThread;			// The number of states each thread expanded
+		size_t										theSizeOftheWorkers;			// The memory size of the threads at the end of the search
+
+		const std::atomic<bool>*					theCancellation;				// When another thread sets it to true, the search stops and reports no plan; 0 when the search cannot be cancelled
+
+																					// Budget (cf. SetBudget/1 and MustStop/1)
+		Budget										theBudget;						// The limits of every search, until the next call to SetBudget/1
+		SearchStatus								theStatus;						// Why the last search stopped
+		INTERNAL_TYPES::u32							theExpansions;					// The nodes expanded by the last search
+		INTERNAL_TYPES::u32							theNextBudgetCheck;				// The clock and the memory are only read when theExpansions reaches it
+		std::chrono::steady_clock::time_point		theStartTime;					// When the last search started
+		Plan										thePartialPlan;					// When theBudget is spent, the plan to the state missing the fewest predicates of theFinalState...
+		PDDL::Number								theCostOfthePartialPlan;		// ... its cost...
+		State::index_type							theMissingGoals;				// ... and the number of predicates of theFinalState missing from its state
+
+																					// Time-sliced search (cf. Step/1 and RunFor/1); the frontier and theStates live on between the calls
+		StartedSearch								theStartedSearch;				// The search to go on with
+		Heuristic*									theStartedHeuristic;			// The heuristic of STARTED_ASTAR and STARTED_GREEDY_BEST_FIRST, owned by the caller
+
+																					// std::vectors
+		std::vector<PDDL::Identifier>				theIdentifiers;					// The union of the constants of the domain and the constants of a problem
+		std::vector<Predicate>						theSharedPredicates;			// In order to be shared among all states of the StateSpaceForwardChaining, thePredicates of theDomain must be globals to the StateSpaceForwardChaining
+		Operator::OperatorSignatures				theSharedOperatorSignatures;	// In order to be shared among all plans of the search frontier, OperatorSignatures must be globals to the StateSpace ForwardChaining
+		IndexedState								theStateIndexedByPredicates;	// Index the predicates of a state in an array; make the index the identifier of the predicates for a very quick access
+		std::vector<Predicate::PredicatesStore::size_type>	theDynamicIdentifiers;	// The identifiers of the predicates which some operator adds or deletes: only they are indexed again for each state...
+		State										theStaticPredicates;			// ... as the predicates of theInitialState with the other identifiers are indexed once, and removed from the states
+		SearchNode::HNode							theExpandedNode;				// The node expanded by BreadthExpand/0 or CostExpand/0 with ApplytheOperators/2...
+		const State*								theExpandedState;				// ... a copy of its state...
+		Successors*									theExpandedSuccessors;			// ... or the children of MaketheSuccessors/2
+
+																					// std::maps
+		StateSpaceForwardChaining::StatePredicates	theStatesPredicates;			// Predicates, instantiated during search, pointing to positions in theSharedPredicates
+
+																					// Grounding (cf. Ground/0)
+		bool										theActionsAreGrounded;			// When true, the search expands with theGroundedActions instead of theDomain operators
+		GroundedActions								theGroundedActions;				// All the actions reachable from theInitialState, ordered as the operators of theDomain are tried
+		std::vector<GroundedAction::HAction>		theActionsBySignature;			// The grounded action of each operator signature of theGroundedActions, GroundedAction::NO_ACTION otherwise
+		State										theReachablePredicates;			// The predicates of theInitialState and all the additions of theGroundedActions
+		GroundedAction::HAction						theIrrelevantActions;			// The number of grounded actions removed by the relevance analysis (cf. PrunetheIrrelevantActions/0)...
+		State::index_type							theIrrelevantPredicates;		// ... and of reachable predicates which neither theFinalState nor the actions kept need
+		SuccessorGenerator							theSuccessorGenerator;			// The decision tree giving the grounded actions applicable to a state
+		StubbornSets								theStubbornSets;				// The partial-order reduction of theApplicableActions, when the operators are grounded (cf. Ground/0)...
+		bool										theStubbornSetsAreUsed;			// ... unless it is disabled (cf. SetStubbornSets/1)
+		Symmetries									theSymmetries;					// The interchangeable objects: the duplicate detection of the grounded expansions keeps one state of each orbit...
+		bool										theSymmetriesAreUsed;			// ... unless it is disabled (cf. SetSymmetries/1)
+		MutexGroups									theMutexGroups;					// The finite-domain variables of the reachable states: theStates are packed with them...
+		bool										theStatesArePacked;				// ... unless it is disabled (cf. SetPackedStates/1)
+		bool										theStatesAreCompressed;			// theStates are stored as deltas to their parents when it is enabled (cf. SetCompressedStates/1), not the states of the threads of HashDistributedAStar/1
+		std::vector<GroundedAction::HAction>		theApplicableActions;			// The grounded actions applicable to the state being expanded
+
+																					// Hash table
+		StateRegistry								theStates;						// Used to check whether a state computed from the application of an operator has already been computed
+		StateRegistry								thePreviousStates;				// The states of the plan repaired by Replan/2
+
+
+		//SPHG::Runtimes_hrc R;
+		//std::string s;
+		//std::ofstream of;
+
+	// ----- Constructor
+	public:
+		StateSpaceForwardChaining(Domain& aDomain, Domain::HProblem aProblem);					// Registers with aProblem: build it on the thread which owns aDomain
+		StateSpaceForwardChaining(const DomainSnapshot& aSnapshot, Domain::HProblem aProblem);	// Registers nowhere: build it on any thread
+
+	private:
+		StateSpaceForwardChaining(const Domain& aDomain, Domain::HProblem aProblem, DomainSnapshot::FrozenProblem aFrozenProblem, Problem* aRegistration);
+
+
+	// ----- Destructor
+	public:
+		~StateSpaceForwardChaining();
+
+
+	// ----- Accessors
+	public:
+		inline Predicate& GetthePredicate(PDDL::HPredicate aPredicate) { return theSharedPredicates[aPredicate]; }
+		inline Predicate MakeCopyOfthePredicate(PDDL::HPredicate aPredicate) const { return theSharedPredicates[aPredicate]; }
+		inline PDDL::HPredicate AddPredicate(const Predicate& aPredicate) {
+			PDDL::HPredicate p = (PDDL::HPredicate) theSharedPredicates.size();
+			theSharedPredicates.push_back(aPredicate);
+			return p;
+		}
+		inline StateSpaceForwardChaining::StatePredicates::const_iterator Find(const Predicate& aPredicate) const {
+			return (theStatesPredicates.find(aPredicate));
+		}
+		inline bool Found(StateSpaceForwardChaining::StatePredicates::const_iterator it) const {
+			return (theStatesPredicates.end() != it);
+		}
+		inline PDDL::HPredicate InsertAsSharedPredicate(const Predicate& aPredicate) {
+			StateSpaceForwardChaining::StatePredicates::const_iterator it = theStatesPredicates.find(aPredicate);
+			if (theStatesPredicates.end() == it)
+			{
+				PDDL::HPredicate p = StateSpaceForwardChaining::AddPredicate(aPredicate);
+				theStatesPredicates[aPredicate] = p;
+				return p;
+			}
+			else // (theStatesPredicates.end() != it)
+				return (it->second);
+		}
+		inline Operator::HOperatorSignature AddOperatorSignature(Operator::OperatorSignature& anOperatorSignature) {
+			Operator::HOperatorSignature p = theSharedOperatorSignatures.size();
+			theSharedOperatorSignatures.push_back(anOperatorSignature);
+			return p;
+		}
+		inline const Plan* GetthePlanFound() const { return &thePlanFound; }
+		inline PDDL::Number GettheCostOfthePlanFound() const { return theCostOfthePlanFound; }
+		inline const GroundedActions& GettheGroundedActions() const { return theGroundedActions; }
+		inline const State& GettheStaticPredicates() const { return theStaticPredicates; }	// Neither in theStates, nor in theFinalState, nor in the preconditions of theGroundedActions
+		inline GroundedAction::HAction GettheIrrelevantActions() const { return theIrrelevantActions; }
+		inline State::index_type GettheIrrelevantPredicates() const { return theIrrelevantPredicates; }
+		inline State GettheInitialState() const { return theStates.GettheState(theInitialState); }
+		inline const State& GettheFinalState() const { return theFinalState; }
+		inline const std::vector<INTERNAL_TYPES::u32>& GettheExpansionsPerThread() const { return theExpansionsPerThread; }
+		inline void SetCancellation(const std::atomic<bool>* aCancellation) { theCancellation = aCancellation; }	// Not changed by Reset/0
+		inline bool IsCancelled() const { return ((0 != theCancellation) && theCancellation->load(std::memory_order_relaxed)); }
+		inline void SetBudget(const Budget& aBudget) { theBudget = aBudget; }	// Not changed by Reset/0
+		inline const Budget& GettheBudget() const { return theBudget; }
+		inline void SetStubbornSets(bool aUse) { theStubbornSetsAreUsed = aUse; }	// Not changed by Reset/0
+		inline bool GettheStubbornSets() const { return theStubbornSetsAreUsed; }
+		inline void SetSymmetries(bool aUse) { theSymmetriesAreUsed = aUse; }	// Not changed by Reset/0
+		inline bool GettheSymmetries() const { return theSymmetriesAreUsed; }
+		inline void SetPackedStates(bool aUse) { theStatesArePacked = aUse; theStates.Pack((aUse && theMutexGroups.IsCompact()) ? &theMutexGroups : 0); }	// Not changed by Reset/0
+		inline bool GetthePackedStates() const { return theStatesArePacked; }
+		inline void SetCompressedStates(bool aUse) { theStatesAreCompressed = aUse; theStates.Compress(aUse); }	// Not changed by Reset/0
+		inline bool GettheCompressedStates() const { return theStatesAreCompressed; }
+		inline const MutexGroups& GettheMutexGroups() const { return theMutexGroups; }	// Empty until Ground/0
+		inline SearchStatus GettheStatus() const { return theStatus; }
+		inline INTERNAL_TYPES::u32 GettheExpansions() const { return theExpansions; }
+		inline const Plan* GetthePartialPlan() const { return &thePartialPlan; }
+		inline PDDL::Number GettheCostOfthePartialPlan() const { return theCostOfthePartialPlan; }
+		inline State::index_type GettheMissingGoals() const { return theMissingGoals; }
+
+
+	// ----- Operations
+	private:
+#if (STL == MEMORY_ALLOCATION)
+		void Apply(State& aState, const Operator* Op, Operator::Predicates& D, PDDL::Parameters P);
+		bool UnifyPreconditions(const Operator* Op, Operator::Predicates& D, PDDL::Parameters P, IndexedState& aMappedCurrentState);
+#elif (DL_MALLOC == MEMORY_ALLOCATION) || (HPHA == MEMORY_ALLOCATION) || (CLASSIC == MEMORY_ALLOCATION)
+		void Apply(State& aState, const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P);
+		bool UnifyPreconditions(const Operator* Op, PDDL::HPredicate* D, PDDL::Parameters P, IndexedState& aMappedCurrentState);
+#else
+	#pragma message (__FILE__ "(" STRING(__LINE__) "): Unknown value <" STRING(MEMORY_ALLOCATION) "> for MEMORY_ALLOCATION (cf. ConditionalCompiling.h)")
+	#error MEMORY_ALLOCATION
+#endif
+
+		Plan MakethePlan(SearchNode::HNode aNode);	// Walk up the parents of aNode to build the plan leading to it
+		PDDL::Number GettheCostOf(const Plan& aPlan) const;	// 1 plus the numeric cost of each operator of aPlan
+		Plan MaketheSymmetricPlan(SearchNode::HNode aNode, Operator::HOperatorSignatures& someOperatorSignatures);	// Map the plan to the canonical state of aNode back to the states actually reached
+		State GettheResultingState(const Plan* aPlan) const;	// The state actually reached by aPlan (cf. Put/4)
+
+		bool Repair(const State& someAdditions, const State& someDeletions);	// Replan/2 once theSymmetries are cleared
+
+		void StartBudget();		// Start counting the expansions and the time of a new search against theBudget
+
+		void PrunetheIrrelevantActions();	// Remove from theGroundedActions the actions which cannot contribute to reaching theFinalState
+		void BuildtheSymmetries(const State& anInitialState);	// theSymmetries of theGroundedActions from anInitialState, with theStaticPredicates
+
+		// The grounded actions applicable to aState, pruned by theStubbornSets unless they are not used
+		inline void GettheApplicableActions(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions) {
+			theSuccessorGenerator.GettheApplicableActions(aState, someApplicableActions);
+			if (theStubbornSetsAreUsed)
+				theStubbornSets.Prune(aState, someApplicableActions);
+		}
+		// Same as GettheApplicableActions/2 with the stack and the scratch of a thread
+		inline void GettheApplicableActions(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions, std::vector<SuccessorGenerator::HNode>& aStack, StubbornSets::Scratch& aScratch) const {
+			theSuccessorGenerator.GettheApplicableActions(aState, someApplicableActions, aStack);
+			if (theStubbornSetsAreUsed)
+				theStubbornSets.Prune(aState, someApplicableActions, aScratch);
+		}
+
+		// The grounded action with anOperatorSignature, GroundedAction::NO_ACTION when there is none
+		inline GroundedAction::HAction GettheAction(Operator::HOperatorSignature anOperatorSignature) const {
+			return ((anOperatorSignature < theActionsBySignature.size()) ? theActionsBySignature[anOperatorSignature] : (GroundedAction::HAction) GroundedAction::NO_ACTION);
+		}
+
+		// Replace aState with the representative of its orbit, unless theSymmetries are not used
+		inline void Canonicalize(State& aState) const {
+			if (theSymmetriesAreUsed)
+				theSymmetries.Canonicalize(aState);
+		}
+
+		bool ExpandtheStartedSearch();	// Expand one node of theStartedSearch; true when it is a solution, and theStatus is no longer SEARCH_IN_PROGRESS once the search ended
+
+		bool MustStop(INTERNAL_TYPES::u32 someExpansions = 1);	// Count someExpansions; true, with theStatus and thePartialPlan made, when the search is cancelled or theBudget is spent
+
+		size_t SizeOftheSearchSpace() const;	// The memory checked against theBudget: the states, nodes and frontiers, without printing as SizeOf/0 does
+
+		void MakethePartialPlan();	// The plan to the state of thePath (IterativeDeepening/1) or of theNodes (the other searches) missing the fewest predicates of theFinalState
+
+		bool ApplytheOperators(const State& aState, LiftedChild aChild);	// Give each child of aState by the domain operators to aChild; true when aChild stops the expansion
+		bool AddBreadthChild(const Operator* anOperator, Domain::HOperator, LiftedParameters someParameters, const State& aState);	// The new children of theExpandedNode go to theOpen; true when aState is a solution
+		bool AddCostChild(const Operator* anOperator, Domain::HOperator Op, LiftedParameters someParameters, const State& aState);	// The new children of theExpandedNode go to theOpenWithCosts; true when aState is a solution
+		bool AddSuccessor(const Operator* anOperator, Domain::HOperator Op, LiftedParameters someParameters, const State& aState);	// All the children go to theExpandedSuccessors; always false
+
+		bool CostExpand();		// Expanding the cheapest node from the search frontier and adding its costy children to it
+
+		bool BreadthExpand();	// Expanding a node and adding its children to the search frontier in a breadth first manner
+
+		bool GroundedCostExpand();		// Same as CostExpand/0, with theGroundedActions
+
+		bool GroundedBreadthExpand();	// Same as BreadthExpand/0, with theGroundedActions
+
+		bool AStarExpand(Heuristic& aHeuristic);	// Expanding the node with the lowest estimated cost, unless it is a solution, and adding its children estimated with aHeuristic
+
+		bool GreedyExpand(Heuristic& aHeuristic);	// Evaluating a node with aHeuristic, then adding its children with this estimate; the children reached by preferred actions are also added to thePreferredOpenWithCosts
+
+		void MaketheSuccessors(const State& aState, Successors& someSuccessors);	// Compute the children of aState, with the operators of theDomain or with theGroundedActions
+
+		bool DepthFirst(Heuristic* aHeuristic, PDDL::Number aCost);	// Expanding the last state of thePath within theBound, recursively; aHeuristic may be 0
+
+		void IndextheForwardState(StateRegistry::HState aState);	// Push aState into theForwardStatesByPredicate
+
+		void MeetForward(SearchNode::HNode aNode);		// Check whether the state of aNode includes the required predicates and excludes the forbidden predicates of some backward node
+		void MeetBackward(SearchNode::HNode aNode);		// Check whether some state of theStates includes the required predicates and excludes the forbidden predicates of a backward node
+
+		bool ForwardLayer();	// Expanding all the nodes of the current depth of theOpen; true when the searches met
+		bool BackwardLayer();	// Regressing all the nodes of the current depth of theBackwardOpen through theGroundedActions; true when the searches met
+
+		void MaketheBidirectionalPlan();	// Join the forward plan to theForwardMeeting and the backward plan from theBackwardMeeting into thePlanFound
+
+		void ExpandthePartOftheLayer(BreadthWorkers::size_type aWorker);	// The work of one thread of ParallelBreadthFirst/1: only reads theOpen, theNodes and theStates
+
+		void HashDistributedReceive(HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker, const HDAMessage& aMessage);	// aWorker registers, tests and estimates the state of aMessage, then opens it when its plan is cheaper
+		void HashDistributedSend(HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker);		// Push the non empty outboxes of aWorker into the inboxes of their receivers
+		void HashDistributedExpand(HDASearch* aSearch, INTERNAL_TYPES::u32 aWorker);	// The work of one thread of HashDistributedAStar/1, until all the threads are idle and all the batches are received
+		bool HashDistributedMustStop(HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker);	// Same as MustStop/1 for aWorker, which is given an equal share of the memory of theBudget
+		Plan MaketheHashDistributedPlan(const HDASearch& aSearch, INTERNAL_TYPES::u32 aWorker, StateRegistry::HState aState, PDDL::Number& aCost);	// Walk up the parents of aState from thread to thread, then replay the plan from theInitialState
+
+	public:
+		size_t SizeOf();
+
+		void Reset();			// Re-initialize data before a new search for the same problem
+
+		bool Ground();			// Instantiate, once and for all, the operators of theDomain which are reachable from theInitialState; false when the predicates do not fit in a State
+
+		bool BreadthFirst(bool memory_consumption_is_measured = false /* default is: memory usage is NOT measured */);	// Breadth first search of the state space
+
+		// Time-sliced searches: a Start.../N operation prepares the search and returns true when theInitialState already is a solution;
+		// theStatus is then SEARCH_IN_PROGRESS until Step/1 or RunFor/1 find a solution (true) or end the search. Reset/0 starts over.
+		bool StartBreadthFirst();					// Same search as BreadthFirst/1
+		bool StartBestFirst();						// Same search as BestFirst/0
+		bool StartAStar(Heuristic& aHeuristic);		// Same search as AStar/1; aHeuristic must live until the search ends
+		bool StartGreedyBestFirst(Heuristic& aHeuristic);	// Same search as GreedyBestFirst/1; aHeuristic must live until the search ends
+
+		bool Step(INTERNAL_TYPES::u32 someExpansions);		// Expand at most someExpansions nodes of the started search
+		bool RunFor(INTERNAL_TYPES::u64 someMicroseconds);	// Expand the nodes of the started search for about someMicroseconds, and at least one node
+
+		// Add and delete predicates (cf. Find/1) of theInitialState, then repair thePlanFound by the previous search; false with theStatus SEARCH_NEEDS_RESTART, and
+		// nothing changed, when Ground/0 did not succeed, did not reach someAdditions, or someDeletions hold a static predicate (cf. GettheStaticPredicates/0)
+		bool Replan(const State& someAdditions, const State& someDeletions);
+
+		bool BestFirst();		// Cheapest-action-cost-first search of the state space
+
+		bool AStar(Heuristic& aHeuristic);	// Cost-optimal search of the state space with an admissible heuristic built on theGroundedActions; false when Ground/0 did not succeed
+
+		bool GreedyBestFirst(Heuristic& aHeuristic);	// Lowest-estimate-first search of the state space with a heuristic built on theGroundedActions, and its preferred actions; false when Ground/0 did not succeed
+
+		bool IterativeDeepening(Heuristic* aHeuristic = 0);	// IDA* with an admissible heuristic built on theGroundedActions, or iterative deepening on the cost of the plans when aHeuristic is 0; memory grows with the length of the plans only
+
+		bool ParallelBreadthFirst(unsigned int someThreads = 0);	// Same as BreadthFirst/1 with theGroundedActions, each layer being expanded by someThreads threads (0: as many as the hardware runs concurrently); false when Ground/0 did not succeed
+
+		bool HashDistributedAStar(std::vector<Heuristic*>& someHeuristics);	// Cost-optimal search with one thread per admissible heuristic (0 for no heuristic), each owning the states whose hash values it is given; false when Ground/0 did not succeed
+
+		bool Bidirectional();	// Breadth first search forward from theInitialState and backward from theFinalState, until they meet; false when Ground/0 did not succeed
+
+		std::ostream& Put(std::ostream& o, const Plan* aPlan, const std::string& tab, const IterationNumber aCurrentIteration = 0) const;
+
+
+	// ----- Interface Operations
+	public:
+		EXTERNAL_TYPES::op_str* ConvertthePlanFound() const;
+		void ConvertthePlanFound(EXTERNAL_TYPES::plan& aPlan /* shall contain the result of the conversion */) const;
+
+		// The returned std::string contains the plans as follows: "action_id_1(param_id_11,...,param_id_1n);action_id_2(param_id_21,...,param_id_2n); ... ; action_id_n(param_id_n1,...,param_id_nn)."
+		std::string ConvertthePlanFoundToString() const;
+
+};
+
+#endif	// _SPHG_PLANNER_SEARCH_SSFC_H
+// ================================================================================================ End of file "StateSpaceForwardChaining.h"
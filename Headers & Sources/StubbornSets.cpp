@@ -0,0 +1,182 @@
+// ================================================================================================ Beginning of file "StubbornSets.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//						 Push/2 --- Add some actions to a stubborn set, unless they are in it already
+//						Build/2 --- Index the grounded actions of a problem by the predicates of their preconditions and effects
+//						Prune/2 --- Keep only the applicable actions of a stubborn set of a state
+//						Prune/3 --- Same as Prune/2 with the scratch of the caller
+//						Clear/0 --- Forget the grounded actions
+//					   SizeOf/0 --- Memory size of the stubborn sets
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::fill
+
+// Project files
+#ifndef _SPHG_PLANNER_STUBBORN_SETS_H
+	#include "StubbornSets.h"				// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Push/2
+//
+static inline void Push(const std::vector<GroundedAction::HAction>& someActions, StubbornSets::Scratch& aScratch) {
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < someActions.size(); ++a)
+		if (aScratch.theMark != aScratch.theMarks[someActions[a]])
+		{
+			aScratch.theMarks[someActions[a]] = aScratch.theMark;
+			aScratch.theQueue.push_back(someActions[a]);
+		}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StubbornSets::Build/2
+//
+void StubbornSets::Build(const GroundedActions& someGroundedActions, const State& aGoal) {
+	StubbornSets::Clear();
+	theGroundedActions = &someGroundedActions;
+	theGoal = aGoal;
+
+	theAdders.resize(State::end());
+	theDeleters.resize(State::end());
+	theRequirers.resize(State::end());
+	theForbidders.resize(State::end());
+	theDeletions.resize(someGroundedActions.size());
+	for (GroundedAction::HAction a = 0; a < someGroundedActions.size(); ++a)
+	{
+		const GroundedAction& anAction = someGroundedActions[a];
+
+		// The deletions first, the additions last (cf. GroundedAction::Apply/1): a predicate both deleted and added is not deleted
+		theDeletions[a] = anAction.GettheDeletions();
+		theDeletions[a].remove(anAction.GettheAdditions());
+
+		for (State::index_type i = anAction.GettheAdditions().first(); i < State::end(); i = anAction.GettheAdditions().next(i))
+			theAdders[i].push_back(a);
+		for (State::index_type i = theDeletions[a].first(); i < State::end(); i = theDeletions[a].next(i))
+			theDeleters[i].push_back(a);
+		for (State::index_type i = anAction.GetthePreconditions().first(); i < State::end(); i = anAction.GetthePreconditions().next(i))
+			theRequirers[i].push_back(a);
+		for (State::index_type i = anAction.GettheNegativePreconditions().first(); i < State::end(); i = anAction.GettheNegativePreconditions().next(i))
+			theForbidders[i].push_back(a);
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StubbornSets::Prune/2
+//
+void StubbornSets::Prune(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions) {
+	StubbornSets::Prune(aState, someApplicableActions, theScratch);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StubbornSets::Prune/3
+//
+// The unsatisfied goal predicate, and the unsatisfied precondition of an action which is not
+// applicable, are chosen with the fewest achievers, so that the stubborn set stays small.
+//
+void StubbornSets::Prune(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions, Scratch& aScratch) const {
+	// A single action cannot be reordered with another one
+	if ((0 == theGroundedActions) || (someApplicableActions.size() <= 1))
+		return;
+
+	// Nothing is pruned from a state including theGoal
+	State::index_type aGoal = State::end();
+	for (State::index_type i = theGoal.first(); i < State::end(); i = theGoal.next(i))
+		if (!aState.find((PDDL::HPredicate) i) && ((State::end() == aGoal) || (theAdders[i].size() < theAdders[aGoal].size())))
+			aGoal = i;
+	if (State::end() == aGoal)
+		return;
+
+	// A new mark empties the stubborn set of the previous call
+	if (aScratch.theMarks.size() != theGroundedActions->size())
+	{
+		aScratch.theMarks.assign(theGroundedActions->size(), 0);
+		aScratch.theMark = 0;
+	}
+	if (0 == ++aScratch.theMark)
+	{
+		std::fill(aScratch.theMarks.begin(), aScratch.theMarks.end(), 0);
+		aScratch.theMark = 1;
+	}
+	aScratch.theQueue.clear();
+
+	Push(theAdders[aGoal], aScratch);
+	for (std::vector<GroundedAction::HAction>::size_type q = 0; q < aScratch.theQueue.size(); ++q)
+	{
+		const GroundedAction::HAction a = aScratch.theQueue[q];
+		const GroundedAction& anAction = (*theGroundedActions)[a];
+
+		if (anAction.IsApplicableTo(aState))
+		{
+			// The actions which disable anAction
+			for (State::index_type i = anAction.GetthePreconditions().first(); i < State::end(); i = anAction.GetthePreconditions().next(i))
+				Push(theDeleters[i], aScratch);
+			for (State::index_type i = anAction.GettheNegativePreconditions().first(); i < State::end(); i = anAction.GettheNegativePreconditions().next(i))
+				Push(theAdders[i], aScratch);
+
+			// The actions disabled by anAction, or adding what it deletes
+			for (State::index_type i = theDeletions[a].first(); i < State::end(); i = theDeletions[a].next(i))
+			{
+				Push(theRequirers[i], aScratch);
+				Push(theAdders[i], aScratch);
+			}
+
+			// The actions disabled by anAction, or deleting what it adds
+			for (State::index_type i = anAction.GettheAdditions().first(); i < State::end(); i = anAction.GettheAdditions().next(i))
+			{
+				Push(theForbidders[i], aScratch);
+				Push(theDeleters[i], aScratch);
+			}
+		}
+		else // (! anAction.IsApplicableTo(aState))
+		{
+			// A necessary enabling set: the achievers of a missing precondition or the deleters of a present negative precondition
+			const std::vector<GroundedAction::HAction>* someAchievers = 0;
+			for (State::index_type i = anAction.GetthePreconditions().first(); i < State::end(); i = anAction.GetthePreconditions().next(i))
+				if (!aState.find((PDDL::HPredicate) i) && ((0 == someAchievers) || (theAdders[i].size() < someAchievers->size())))
+					someAchievers = &theAdders[i];
+			for (State::index_type i = anAction.GettheNegativePreconditions().first(); i < State::end(); i = anAction.GettheNegativePreconditions().next(i))
+				if (aState.find((PDDL::HPredicate) i) && ((0 == someAchievers) || (theDeleters[i].size() < someAchievers->size())))
+					someAchievers = &theDeleters[i];
+			Push(*someAchievers, aScratch);
+		}
+	}
+
+	// Keep the applicable actions of the stubborn set, in the same order
+	std::vector<GroundedAction::HAction>::size_type k = 0;
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < someApplicableActions.size(); ++a)
+		if (aScratch.theMark == aScratch.theMarks[someApplicableActions[a]])
+			someApplicableActions[k++] = someApplicableActions[a];
+	someApplicableActions.resize(k);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StubbornSets::Clear/0
+//
+void StubbornSets::Clear() {
+	theGroundedActions = 0;
+	theGoal.clear();
+	theDeletions.clear();
+	theAdders.clear();
+	theDeleters.clear();
+	theRequirers.clear();
+	theForbidders.clear();
+	theScratch.theMarks.clear();
+	theScratch.theMark = 0;
+	theScratch.theQueue.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// StubbornSets::SizeOf/0
+//
+size_t StubbornSets::SizeOf() const {
+	size_t s = sizeof(*this)
+			 + theDeletions.capacity() * sizeof(State)
+			 + (theAdders.capacity() + theDeleters.capacity() + theRequirers.capacity() + theForbidders.capacity()) * sizeof(std::vector<GroundedAction::HAction>)
+			 + theScratch.theMarks.capacity() * sizeof(INTERNAL_TYPES::u32)
+			 + theScratch.theQueue.capacity() * sizeof(GroundedAction::HAction);
+	for (ActionsByPredicate::size_type i = 0; i < theAdders.size(); ++i)
+		s += (theAdders[i].capacity() + theDeleters[i].capacity() + theRequirers[i].capacity() + theForbidders[i].capacity()) * sizeof(GroundedAction::HAction);
+
+	return s;
+}
+
+// ================================================================================================ End of file "StubbornSets.cpp"
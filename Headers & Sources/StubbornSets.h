@@ -0,0 +1,95 @@
+// ================================================================================================ Beginning of file "StubbornSets.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_STUBBORN_SETS_H
+#define _SPHG_PLANNER_STUBBORN_SETS_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the actions indexed by predicates
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+	#include "GroundedAction.h"			// Visibility for GroundedAction and GroundedActions
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// Strong stubborn sets: a partial-order reduction which keeps, among the grounded actions applicable
+// to a State, only those of a stubborn set. The set starts with the achievers of an unsatisfied goal
+// predicate and is closed under two rules:
+//		- an action applicable to the State brings every action interfering with it: the actions which
+//		  disable it or which it disables (deleting a precondition, adding a negative precondition),
+//		  and the actions whose effects conflict with its effects (one adds what the other deletes);
+//		- an action not applicable to the State brings the achievers of one of its unsatisfied
+//		  preconditions (a necessary enabling set).
+// Any plan from the State can then be reordered into a plan of the same cost starting with an action
+// of the stubborn set, so that the searches stay complete, and the cost-optimal searches optimal,
+// while they no longer explore every interleaving of independent actions (e.g. of different agents).
+//
+// The actions are indexed once by the predicates they add, delete, require and forbid; only the
+// Scratch given to Prune/3 is written during the search, so that several threads may share this object.
+//
+class StubbornSets {
+	// ----- Types
+	public:
+		struct Scratch {										// What Prune/3 writes to: one per thread
+			std::vector<INTERNAL_TYPES::u32>		theMarks;		// theMarks[a] == theMark when the action a is in the stubborn set
+			INTERNAL_TYPES::u32						theMark;
+			std::vector<GroundedAction::HAction>	theQueue;		// The actions of the stubborn set, in the order they were added
+			Scratch() : theMark(0) {}
+		};
+
+	private:
+		typedef		std::vector< std::vector<GroundedAction::HAction> >		ActionsByPredicate;	// One vector of actions per predicate of a State
+
+
+	// ----- Properties
+	private:
+		const GroundedActions*					theGroundedActions;	// The grounded actions the sets are made of
+		State									theGoal;
+		std::vector<State>						theDeletions;		// The deletions of each action which it does not add again
+		ActionsByPredicate						theAdders;			// The actions adding a predicate
+		ActionsByPredicate						theDeleters;		// The actions deleting a predicate without adding it again
+		ActionsByPredicate						theRequirers;		// The actions with a predicate as a (positive) precondition
+		ActionsByPredicate						theForbidders;		// The actions with a predicate as a negative precondition
+		Scratch									theScratch;			// The scratch of Prune/2
+
+
+	// ----- Constructors
+	public:
+		StubbornSets() : theGroundedActions(0) {}
+
+
+	// ----- Accessors
+	public:
+		inline bool Empty() const { return (0 == theGroundedActions); }
+
+
+	// ----- Operations
+	public:
+		void Build(const GroundedActions& someGroundedActions, const State& aGoal);	// Index someGroundedActions for the searches of aGoal
+
+		// Keep in someApplicableActions, the actions applicable to aState in increasing order, only those of a stubborn set of aState
+		void Prune(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions);
+		// Same as Prune/2 with aScratch, so that several threads may share these stubborn sets
+		void Prune(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions, Scratch& aScratch) const;
+
+		void Clear();
+		size_t SizeOf() const;
+};
+
+#endif	// _SPHG_PLANNER_STUBBORN_SETS_H
+// ================================================================================================ End of file "StubbornSets.h"
@@ -0,0 +1,159 @@
+// ================================================================================================ Beginning of file "SuccessorGenerator.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//		 NextPrecondition/2 --- The next precondition of an action to test in the decision tree
+//					Build/1 --- Build the decision tree of the grounded actions of a problem
+//					Build/2 --- Build the subtree of some actions, recursively
+// GettheApplicableActions/2 --- Walk down the decision tree to collect the actions applicable to a state
+// GettheApplicableActions/3 --- Same as GettheApplicableActions/2 with the stack of the caller
+//					Clear/0 --- Empty the decision tree
+//				   SizeOf/0 --- Memory size of the decision tree
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::sort
+
+// Project files
+#ifndef _SPHG_PLANNER_SUCCESSOR_GENERATOR_H
+	#include "SuccessorGenerator.h"		// Class visibility
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Static members
+//
+const SuccessorGenerator::HNode SuccessorGenerator::NO_NODE;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// NextPrecondition/2
+//
+// The smallest precondition of anAction which is greater or equal to aPredicate; State::end() when there is none
+//
+static inline State::index_type NextPrecondition(const GroundedAction& anAction, State::index_type aPredicate) {
+	return ((0 == aPredicate) ? anAction.GetthePreconditions().first() : anAction.GetthePreconditions().next(aPredicate - 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// SuccessorGenerator::Build/1
+//
+void SuccessorGenerator::Build(const GroundedActions& someGroundedActions) {
+	SuccessorGenerator::Clear();
+	theGroundedActions = &someGroundedActions;
+
+	std::vector<GroundedAction::HAction> allActions(someGroundedActions.size());
+	for (GroundedAction::HAction a = 0; a < allActions.size(); ++a)
+		allActions[a] = a;
+
+	SuccessorGenerator::Build(allActions, 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// SuccessorGenerator::Build/2
+//
+SuccessorGenerator::HNode SuccessorGenerator::Build(std::vector<GroundedAction::HAction>& someActions, State::index_type aPredicate) {
+	// Make a new node; it shall be accessed with its position n, as building its children may move theNodes
+	HNode n = (HNode) theNodes.size();
+	theNodes.push_back(Node());
+	theNodes[n].theRequired = NO_NODE;
+	theNodes[n].theDontCare = NO_NODE;
+
+	// Store at this node the actions whose preconditions have all been tested, and look for the next predicate to test
+	State::index_type theNextPredicate = State::end();
+	theNodes[n].theFirstAction = theActions.size();
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < someActions.size(); ++a)
+	{
+		State::index_type p = NextPrecondition((*theGroundedActions)[someActions[a]], aPredicate);
+		if (State::end() == p)
+			theActions.push_back(someActions[a]);
+		else if (p < theNextPredicate)
+			theNextPredicate = p;
+	}
+	theNodes[n].theLastAction = theActions.size();
+	theNodes[n].thePredicate = theNextPredicate;
+
+	// This node is a leaf when all the preconditions of someActions have been tested
+	if (State::end() == theNextPredicate)
+		return n;
+
+	// Split the remaining actions on theNextPredicate
+	std::vector<GroundedAction::HAction> theRequiredActions;
+	std::vector<GroundedAction::HAction> theDontCareActions;
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < someActions.size(); ++a)
+	{
+		State::index_type p = NextPrecondition((*theGroundedActions)[someActions[a]], aPredicate);
+		if (theNextPredicate == p)
+			theRequiredActions.push_back(someActions[a]);
+		else if (State::end() != p)
+			theDontCareActions.push_back(someActions[a]);
+	}
+
+	// No need for someActions any longer: free some memory before going down the tree
+	std::vector<GroundedAction::HAction>().swap(someActions);
+
+	HNode r = SuccessorGenerator::Build(theRequiredActions, theNextPredicate + 1);
+	theNodes[n].theRequired = r;
+	if (! theDontCareActions.empty())
+	{
+		HNode d = SuccessorGenerator::Build(theDontCareActions, theNextPredicate + 1);
+		theNodes[n].theDontCare = d;
+	}
+
+	return n;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// SuccessorGenerator::GettheApplicableActions/2
+//
+void SuccessorGenerator::GettheApplicableActions(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions) {
+	SuccessorGenerator::GettheApplicableActions(aState, someApplicableActions, theStack);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// SuccessorGenerator::GettheApplicableActions/3
+//
+void SuccessorGenerator::GettheApplicableActions(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions, std::vector<HNode>& aStack) const {
+	someApplicableActions.clear();
+	if (theNodes.empty())
+		return;
+
+	aStack.clear();
+	aStack.push_back(0);
+	while (! aStack.empty())
+	{
+		const Node& aNode = theNodes[aStack.back()];
+		aStack.pop_back();
+
+		// The positive preconditions of the actions at this node are all in aState; check their negative preconditions
+		for (std::vector<GroundedAction::HAction>::size_type a = aNode.theFirstAction; a < aNode.theLastAction; ++a)
+			if (! aState.intersects((*theGroundedActions)[theActions[a]].GettheNegativePreconditions()))
+				someApplicableActions.push_back(theActions[a]);
+
+		if (State::end() != aNode.thePredicate)
+		{
+			if (NO_NODE != aNode.theDontCare)
+				aStack.push_back(aNode.theDontCare);
+			if (aState.find((PDDL::HPredicate) aNode.thePredicate))
+				aStack.push_back(aNode.theRequired);
+		}
+	}
+
+	// Give the applicable actions in the order of theGroundedActions
+	std::sort(someApplicableActions.begin(), someApplicableActions.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// SuccessorGenerator::Clear/0
+//
+void SuccessorGenerator::Clear() {
+	theNodes.clear();
+	theActions.clear();
+	theStack.clear();
+	theGroundedActions = 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// SuccessorGenerator::SizeOf/0
+//
+size_t SuccessorGenerator::SizeOf() const {
+	return (sizeof(*this)
+			+ theNodes.capacity() * sizeof(Node)
+			+ theActions.capacity() * sizeof(GroundedAction::HAction)
+			+ theStack.capacity() * sizeof(HNode));
+}
+
+// ================================================================================================ End of file "SuccessorGenerator.cpp"
@@ -0,0 +1,91 @@
+// ================================================================================================ Beginning of file "SuccessorGenerator.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_SUCCESSOR_GENERATOR_H
+#define _SPHG_PLANNER_SUCCESSOR_GENERATOR_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the nodes of the decision tree and the actions at these nodes
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+	#include "GroundedAction.h"			// Visibility for GroundedAction and GroundedActions
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// A decision tree over the (positive) preconditions of the grounded actions of a problem. Each node
+// tests one predicate: the actions requiring this predicate are below its "required" child and the
+// others are below its "don't care" child; the actions whose preconditions have all been tested on
+// the way down to a node are stored at this node. The predicates are tested in increasing order along
+// any path, so that the actions applicable to a State are found by only visiting the "required"
+// children of the predicates of this State.
+//
+class SuccessorGenerator {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			HNode;				// At most 4294967296 nodes in the decision tree
+
+		static const HNode NO_NODE = 0xFFFFFFFF;					// No child
+
+	private:
+		struct Node {
+			State::index_type					thePredicate;		// The predicate tested at this node; State::end() for a leaf
+			HNode								theRequired;		// The subtree of the actions requiring thePredicate
+			HNode								theDontCare;		// The subtree of the actions not requiring thePredicate
+			std::vector<GroundedAction::HAction>::size_type	theFirstAction;	// The actions whose preconditions have all been tested are in theActions,
+			std::vector<GroundedAction::HAction>::size_type	theLastAction;	// in the range [theFirstAction, theLastAction)
+		};
+
+
+	// ----- Properties
+	private:
+		std::vector<Node>						theNodes;			// The decision tree; its root is theNodes[0]
+		std::vector<GroundedAction::HAction>	theActions;			// The actions stored at the nodes of the decision tree
+		const GroundedActions*					theGroundedActions;	// The grounded actions this decision tree was built from
+		std::vector<HNode>						theStack;			// The nodes yet to visit when looking for the applicable actions
+
+
+	// ----- Constructors
+	public:
+		SuccessorGenerator() : theGroundedActions(0) {}
+
+
+	// ----- Accessors
+	public:
+		inline bool Empty() const { return theNodes.empty(); }
+		inline HNode Size() const { return (HNode) theNodes.size(); }
+
+
+	// ----- Operations
+	public:
+		void Build(const GroundedActions& someGroundedActions);	// Build the decision tree of someGroundedActions
+
+		// Replace the content of someApplicableActions with the actions applicable to aState, in increasing order
+		void GettheApplicableActions(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions);
+		// Same as GettheApplicableActions/2 with aStack as the nodes yet to visit, so that several threads may share this decision tree
+		void GettheApplicableActions(const State& aState, std::vector<GroundedAction::HAction>& someApplicableActions, std::vector<HNode>& aStack) const;
+
+		void Clear();
+		size_t SizeOf() const;
+
+	private:
+		// Build the subtree of someActions whose preconditions below aPredicate have already been tested
+		HNode Build(std::vector<GroundedAction::HAction>& someActions, State::index_type aPredicate);
+};
+
+#endif	// _SPHG_PLANNER_SUCCESSOR_GENERATOR_H
+// ================================================================================================ End of file "SuccessorGenerator.h"
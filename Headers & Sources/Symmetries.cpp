@@ -0,0 +1,282 @@
+// ================================================================================================ Beginning of file "Symmetries.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//						  Less/2 --- The lexicographic order of the states, slot by slot
+//						 Swap/12 --- The permutation swapping two objects, when it maps the grounded problem onto itself
+//						 Build/6 --- Find the classes of interchangeable objects and the swaps of neighbours in each class
+//				  Canonicalize/2 --- Swap objects while the state gets smaller
+//					  Identity/1 --- The permutation changing nothing
+//					   Compose/2 --- Apply a generator before a permutation
+//						 Apply/3 --- The image of a state by a permutation
+//						 Clear/0 --- Forget the generators
+//						SizeOf/0 --- Memory size of the generators
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+// STL and STD files
+#include <algorithm>					// Visibility for std::sort
+#include <map>							// Visibility for std::map
+
+// Project files
+#ifndef _SPHG_PLANNER_SYMMETRIES_H
+	#include "Symmetries.h"					// Class visibility
+#endif
+
+// The predicates and the grounded actions by their contents: identifiers first, parameters next
+typedef std::map<std::vector<PDDL::HIdentifier>, State::index_type>			PredicatesByContents;
+typedef std::map<std::vector<PDDL::HIdentifier>, GroundedAction::HAction>	ActionsByContents;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Less/2
+//
+static inline bool Less(const State& aState, const State& anotherState) {
+	for (unsigned char s = 0; s < State::slots(); ++s)
+		if (aState.slot(s) != anotherState.slot(s))
+			return (aState.slot(s) < anotherState.slot(s));
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Swap/12
+//
+// The signature of an action ends with the identifier of its operator (cf. Operator::MaketheOperatorSignature/1):
+// swapping all its positions but the last swaps its parameters.
+//
+static bool Swap(PDDL::HIdentifier o1, PDDL::HIdentifier o2, const GroundedActions& someGroundedActions, const Operator::OperatorSignatures& someOperatorSignatures, const std::vector<Predicate>& somePredicates,
+				 const State& someReachablePredicates, const PredicatesByContents& thePredicates, const ActionsByContents& theActions, const State& anInitialState, const State& aGoal,
+				 Symmetries::Permutation& aPermutation, State& aSupport) {
+	aPermutation = Symmetries::Identity((GroundedAction::HAction) someGroundedActions.size());
+	aSupport.clear();
+
+	// The reachable predicates are mapped onto the reachable predicates
+	std::vector<PDDL::HIdentifier> aKey;
+	for (State::index_type i = someReachablePredicates.first(); i < State::end(); i = someReachablePredicates.next(i))
+	{
+		const Predicate& aPredicate = somePredicates[i];
+		aKey.assign(1, aPredicate.GettheIdentifier());
+		bool anObjectIsSwapped = false;
+		for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
+		{
+			PDDL::HIdentifier v = aPredicate.GettheParameter(a);
+			if ((o1 == v) || (o2 == v))
+			{
+				v = (o1 == v) ? o2 : o1;
+				anObjectIsSwapped = true;
+			}
+			aKey.push_back(v);
+		}
+		if (! anObjectIsSwapped)
+			continue;
+
+		PredicatesByContents::const_iterator f = thePredicates.find(aKey);
+		if (thePredicates.end() == f)
+			return false;
+		aPermutation.thePredicates[i] = f->second;
+		aSupport.insert((PDDL::HPredicate) i);
+	}
+
+	// The initial state and the goal are mapped onto themselves
+	State anImage;
+	Symmetries::Apply(aPermutation, anInitialState, anImage);
+	if (anImage != anInitialState)
+		return false;
+	Symmetries::Apply(aPermutation, aGoal, anImage);
+	if (anImage != aGoal)
+		return false;
+
+	// Each grounded action is mapped onto a grounded action of the same cost with the images of its predicates
+	for (GroundedAction::HAction a = 0; a < someGroundedActions.size(); ++a)
+	{
+		const GroundedAction& anAction = someGroundedActions[a];
+		const Operator::OperatorSignature& anOS = someOperatorSignatures[anAction.GettheOperatorSignature()];
+		aKey.assign(1, anOS[anOS.size() - 1]);
+		for (size_t p = 0; p + 1 < anOS.size(); ++p)
+			aKey.push_back((o1 == anOS[p]) ? o2 : ((o2 == anOS[p]) ? o1 : anOS[p]));
+
+		ActionsByContents::const_iterator f = theActions.find(aKey);
+		if (theActions.end() == f)
+			return false;
+		const GroundedAction& anotherAction = someGroundedActions[f->second];
+		if (anotherAction.GettheCost() != anAction.GettheCost())
+			return false;
+
+		Symmetries::Apply(aPermutation, anAction.GetthePreconditions(), anImage);
+		if (anImage != anotherAction.GetthePreconditions())
+			return false;
+		Symmetries::Apply(aPermutation, anAction.GettheNegativePreconditions(), anImage);
+		if (anImage != anotherAction.GettheNegativePreconditions())
+			return false;
+		Symmetries::Apply(aPermutation, anAction.GettheDeletions(), anImage);
+		if (anImage != anotherAction.GettheDeletions())
+			return false;
+		Symmetries::Apply(aPermutation, anAction.GettheAdditions(), anImage);
+		if (anImage != anotherAction.GettheAdditions())
+			return false;
+
+		aPermutation.theActions[a] = f->second;
+	}
+
+	return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::Build/6
+//
+// Only the objects with the same profile (the predicates, and the positions in them, where they appear
+// in the reachable predicates, theInitialState and the goal) may be interchangeable: the swaps are
+// only tried between them, with the first object of each class found so far.
+//
+void Symmetries::Build(const GroundedActions& someGroundedActions, const Operator::OperatorSignatures& someOperatorSignatures, const std::vector<Predicate>& somePredicates,
+					   const State& someReachablePredicates, const State& anInitialState, const State& aGoal) {
+	Symmetries::Clear();
+
+	typedef std::vector< std::pair<INTERNAL_TYPES::u32, PDDL::HIdentifier> > Profile;	// (kind * 256 + position, identifier of the predicate), sorted
+	std::map<PDDL::HIdentifier, Profile> theProfiles;
+
+	PredicatesByContents thePredicates;
+	std::vector<PDDL::HIdentifier> aKey;
+	for (State::index_type i = someReachablePredicates.first(); i < State::end(); i = someReachablePredicates.next(i))
+	{
+		const Predicate& aPredicate = somePredicates[i];
+		aKey.assign(1, aPredicate.GettheIdentifier());
+		for (Predicate::HArity a = 0; a < aPredicate.GettheArity(); ++a)
+		{
+			aKey.push_back(aPredicate.GettheParameter(a));
+
+			const INTERNAL_TYPES::u32 aPosition = (INTERNAL_TYPES::u32) a;
+			Profile& aProfile = theProfiles[aPredicate.GettheParameter(a)];
+			aProfile.push_back(std::make_pair(aPosition, aPredicate.GettheIdentifier()));
+			if (anInitialState.find((PDDL::HPredicate) i))
+				aProfile.push_back(std::make_pair(256 + aPosition, aPredicate.GettheIdentifier()));
+			if (aGoal.find((PDDL::HPredicate) i))
+				aProfile.push_back(std::make_pair(512 + aPosition, aPredicate.GettheIdentifier()));
+		}
+		thePredicates[aKey] = i;
+	}
+
+	ActionsByContents theActions;
+	for (GroundedAction::HAction a = 0; a < someGroundedActions.size(); ++a)
+	{
+		const Operator::OperatorSignature& anOS = someOperatorSignatures[someGroundedActions[a].GettheOperatorSignature()];
+		aKey.assign(1, anOS[anOS.size() - 1]);
+		for (size_t p = 0; p + 1 < anOS.size(); ++p)
+			aKey.push_back(anOS[p]);
+		theActions[aKey] = a;
+	}
+
+	// The objects with the same profile, in increasing order
+	std::map<Profile, std::vector<PDDL::HIdentifier> > theCandidates;
+	for (std::map<PDDL::HIdentifier, Profile>::iterator o = theProfiles.begin(); o != theProfiles.end(); ++o)
+	{
+		std::sort(o->second.begin(), o->second.end());
+		theCandidates[o->second].push_back(o->first);
+	}
+
+	Permutation aPermutation;
+	State aSupport;
+	for (std::map<Profile, std::vector<PDDL::HIdentifier> >::const_iterator c = theCandidates.begin(); c != theCandidates.end(); ++c)
+	{
+		// Being interchangeable is an equivalence: an object joins the first class whose first object it can be swapped with
+		std::vector< std::vector<PDDL::HIdentifier> > theClasses;
+		for (std::vector<PDDL::HIdentifier>::size_type o = 0; o < c->second.size(); ++o)
+		{
+			std::vector< std::vector<PDDL::HIdentifier> >::size_type k = 0;
+			while ((k < theClasses.size()) && !Swap(theClasses[k].front(), c->second[o], someGroundedActions, someOperatorSignatures, somePredicates, someReachablePredicates, thePredicates, theActions, anInitialState, aGoal, aPermutation, aSupport))
+				++k;
+			if (k == theClasses.size())
+				theClasses.push_back(std::vector<PDDL::HIdentifier>());
+			theClasses[k].push_back(c->second[o]);
+		}
+
+		// The swaps of neighbours generate all the permutations of a class
+		for (std::vector< std::vector<PDDL::HIdentifier> >::size_type k = 0; k < theClasses.size(); ++k)
+			for (std::vector<PDDL::HIdentifier>::size_type o = 1; o < theClasses[k].size(); ++o)
+				if (Swap(theClasses[k][o - 1], theClasses[k][o], someGroundedActions, someOperatorSignatures, somePredicates, someReachablePredicates, thePredicates, theActions, anInitialState, aGoal, aPermutation, aSupport))
+				{
+					theSwaps.push_back(std::make_pair(theClasses[k][o - 1], theClasses[k][o]));
+					theGenerators.push_back(aPermutation);
+					theSupports.push_back(aSupport);
+				}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::Canonicalize/2
+//
+// Each swap of a generator is its own inverse: aState is recovered from its representative by
+// applying someGenerators again, the last one first.
+//
+void Symmetries::Canonicalize(State& aState, std::vector<HGenerator>* someGenerators /* default value is 0 */) const {
+	State anImage;
+	bool aSmallerStateWasFound = !theGenerators.empty();
+	while (aSmallerStateWasFound)
+	{
+		aSmallerStateWasFound = false;
+		for (HGenerator g = 0; g < theGenerators.size(); ++g)
+			if (aState.intersects(theSupports[g]))
+			{
+				Symmetries::Apply(theGenerators[g], aState, anImage);
+				if (Less(anImage, aState))
+				{
+					aState = anImage;
+					if (0 != someGenerators)
+						someGenerators->push_back(g);
+					aSmallerStateWasFound = true;
+				}
+			}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::Identity/1
+//
+Symmetries::Permutation Symmetries::Identity(GroundedAction::HAction aNumberOfActions) {
+	Permutation aPermutation;
+	aPermutation.thePredicates.resize(State::end());
+	for (State::index_type i = 0; i < State::end(); ++i)
+		aPermutation.thePredicates[i] = i;
+	aPermutation.theActions.resize(aNumberOfActions);
+	for (GroundedAction::HAction a = 0; a < aNumberOfActions; ++a)
+		aPermutation.theActions[a] = a;
+
+	return aPermutation;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::Compose/2
+//
+void Symmetries::Compose(Permutation& aPermutation, HGenerator g) const {
+	const Permutation aCopy(aPermutation);
+	for (std::vector<State::index_type>::size_type i = 0; i < aPermutation.thePredicates.size(); ++i)
+		aPermutation.thePredicates[i] = aCopy.thePredicates[theGenerators[g].thePredicates[i]];
+	for (std::vector<GroundedAction::HAction>::size_type a = 0; a < aPermutation.theActions.size(); ++a)
+		aPermutation.theActions[a] = aCopy.theActions[theGenerators[g].theActions[a]];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::Apply/3
+//
+void Symmetries::Apply(const Permutation& aPermutation, const State& aState, State& anImage) {
+	anImage.clear();
+	for (State::index_type i = aState.first(); i < State::end(); i = aState.next(i))
+		anImage.insert((PDDL::HPredicate) aPermutation.thePredicates[i]);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::Clear/0
+//
+void Symmetries::Clear() {
+	theSwaps.clear();
+	theGenerators.clear();
+	theSupports.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Symmetries::SizeOf/0
+//
+size_t Symmetries::SizeOf() const {
+	size_t s = sizeof(*this)
+			 + theSwaps.capacity() * sizeof(std::pair<PDDL::HIdentifier, PDDL::HIdentifier>)
+			 + theGenerators.capacity() * sizeof(Permutation)
+			 + theSupports.capacity() * sizeof(State);
+	for (std::vector<Permutation>::size_type g = 0; g < theGenerators.size(); ++g)
+		s += theGenerators[g].thePredicates.capacity() * sizeof(State::index_type) + theGenerators[g].theActions.capacity() * sizeof(GroundedAction::HAction);
+
+	return s;
+}
+
+// ================================================================================================ End of file "Symmetries.cpp"
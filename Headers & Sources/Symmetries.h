@@ -0,0 +1,101 @@
+// ================================================================================================ Beginning of file "Symmetries.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_SYMMETRIES_H
+#define _SPHG_PLANNER_SYMMETRIES_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <utility>		// Visibility for std::pair
+#include <vector>		// STL Store house for the permutations of the predicates and of the actions
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PLANNER_GROUNDED_ACTION_H
+	#include "GroundedAction.h"			// Visibility for GroundedAction and GroundedActions
+#endif
+
+#ifndef _SPHG_PLANNER_OPERATOR_H
+	#include "Operator.h"				// Visibility for Operator::OperatorSignatures
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::HIdentifier
+#endif
+
+#ifndef _SPHG_PLANNER_PREDICATE_H
+	#include "Predicate.h"
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// Object symmetries: two objects of a problem are interchangeable when swapping them everywhere maps
+// the reachable predicates, theInitialState, the goal and the grounded actions (with their costs) onto
+// themselves; the operators of the domain are then symmetric too, even those naming constants. Being
+// interchangeable is an equivalence: the objects of a class (e.g. identical packages or blocks) can be
+// permuted in any way, and the swaps of neighbours in a class generate all these permutations.
+//
+// Symmetric states have plans of the same costs to the goal: a search may keep a single state of each
+// orbit. Canonicalize/2 maps a state to a representative of its orbit with a greedy orbit search,
+// swapping objects while the state gets lexicographically smaller. Two states with the same
+// representative are always symmetric, but two symmetric states may have different representatives:
+// the reduction is safe, only not always maximal.
+//
+// Once built, nothing is written: several threads may share this object.
+//
+class Symmetries {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32		HGenerator;			// A position in theGenerators
+
+		struct Permutation {													// The image of each predicate of a State and of each grounded action
+			std::vector<State::index_type>			thePredicates;
+			std::vector<GroundedAction::HAction>	theActions;
+		};
+
+
+	// ----- Properties
+	private:
+		std::vector< std::pair<PDDL::HIdentifier, PDDL::HIdentifier> >	theSwaps;		// The two objects swapped by each generator...
+		std::vector<Permutation>										theGenerators;	// ... the permutation it makes...
+		std::vector<State>												theSupports;	// ... and the predicates it moves
+
+
+	// ----- Accessors
+	public:
+		inline bool Empty() const { return theGenerators.empty(); }
+		inline HGenerator GettheNumberOfGenerators() const { return (HGenerator) theGenerators.size(); }
+		inline const std::pair<PDDL::HIdentifier, PDDL::HIdentifier>& GettheSwap(HGenerator g) const { return theSwaps[g]; }
+
+
+	// ----- Operations
+	public:
+		// Find the classes of interchangeable objects of a grounded problem and the swaps generating their permutations
+		void Build(const GroundedActions& someGroundedActions, const Operator::OperatorSignatures& someOperatorSignatures, const std::vector<Predicate>& somePredicates,
+				   const State& someReachablePredicates, const State& anInitialState, const State& aGoal);
+
+		// Replace aState with the representative of its orbit; the generators applied, in order, are appended to someGenerators
+		void Canonicalize(State& aState, std::vector<HGenerator>* someGenerators = 0) const;
+
+		static Permutation Identity(GroundedAction::HAction aNumberOfActions);
+		void Compose(Permutation& aPermutation, HGenerator g) const;	// aPermutation becomes aPermutation after (the permutation of) g
+
+		static void Apply(const Permutation& aPermutation, const State& aState, State& anImage);
+
+		void Clear();
+		size_t SizeOf() const;
+};
+
+#endif	// _SPHG_PLANNER_SYMMETRIES_H
+// ================================================================================================ End of file "Symmetries.h"
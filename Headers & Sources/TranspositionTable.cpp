@@ -0,0 +1,75 @@
+// ================================================================================================ Beginning of file "TranspositionTable.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//		  TranspositionTable/1 --- Allocate the slots of the table once and for all
+//			   NextIteration/0 --- Forget the states of the previous iteration
+//					   Prune/2 --- Has a state already been reached as cheaply during this iteration?
+//					  SizeOf/0 --- Memory size of the table
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+#ifndef _SPHG_PLANNER_TRANSPOSITION_TABLE_H
+	#include "TranspositionTable.h"			// Class visibility
+#endif
+
+#ifndef _SPHG_PLANNER_STATE_REGISTRY_H
+	#include "StateRegistry.h"				// Visibility for StateRegistry::Hash/1
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// TranspositionTable::TranspositionTable/1
+//
+TranspositionTable::TranspositionTable(size_type someSlots) : theMask(0), theIteration(1) {
+	if (0 == someSlots)
+		return;
+
+	size_type aPowerOf2 = 1;
+	while (aPowerOf2 <= someSlots / 2)
+		aPowerOf2 *= 2;
+
+	Entry anEmptyEntry;
+	anEmptyEntry.theCost = 0.0f;
+	anEmptyEntry.theIteration = 0;
+	theEntries.assign(aPowerOf2, anEmptyEntry);
+	theMask = aPowerOf2 - 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// TranspositionTable::NextIteration/0
+//
+void TranspositionTable::NextIteration() {
+	// Entries are stamped with their iteration: a new iteration number empties all the entries at once...
+	if (0 != ++theIteration)
+		return;
+
+	// ... but for the once in 4294967295 iterations when the iteration number wraps around
+	for (std::vector<Entry>::size_type e = 0; e < theEntries.size(); ++e)
+		theEntries[e].theIteration = 0;
+	theIteration = 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// TranspositionTable::Prune/2
+//
+bool TranspositionTable::Prune(const State& aState, PDDL::Number aCost) {
+	if (theEntries.empty())
+		return false;
+
+	Entry& anEntry = theEntries[(size_type) StateRegistry::Hash(aState) & theMask];
+	if ((theIteration == anEntry.theIteration) && (anEntry.theCost <= aCost) && (anEntry.theState == aState))
+		return true;
+
+	anEntry.theState = aState;
+	anEntry.theCost = aCost;
+	anEntry.theIteration = theIteration;
+
+	return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// TranspositionTable::SizeOf/0
+//
+size_t TranspositionTable::SizeOf() const {
+	return (sizeof(*this) + theEntries.capacity() * sizeof(Entry));
+}
+
+// ================================================================================================ End of file "TranspositionTable.cpp"
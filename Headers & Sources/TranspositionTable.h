@@ -0,0 +1,78 @@
+// ================================================================================================ Beginning of file "TranspositionTable.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_TRANSPOSITION_TABLE_H
+#define _SPHG_PLANNER_TRANSPOSITION_TABLE_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <stddef.h>		// Visibility for size_t
+#include <vector>		// STL Store house for the entries of the table
+
+// Project files
+#ifndef _INTERNAL_TYPES_H
+	#include "InternalTypes.h"			// Visibility for u32
+#endif
+
+#ifndef _SPHG_PDDL_H
+	#include "PDDL.h"					// Visibility for PDDL::Number
+#endif
+
+#ifndef _SPHG_PLANNER_STATES_H
+	#include "States.h"					// Visibility for State
+#endif
+
+// ------------------------------------------------------------------------------------------------ Class definition
+// A fixed size memory of the states reached during one iteration of a depth first search, with the
+// cost of the cheapest plan which reached them. Each State has a single slot, chosen with its hash
+// value, and a State replaces whatever was in its slot: the table forgets states but never grows.
+// The entries of previous iterations are ignored, so that starting an iteration costs nothing.
+//
+class TranspositionTable {
+	// ----- Types
+	public:
+		typedef		INTERNAL_TYPES::u32			size_type;			// At most 4294967296 slots
+		typedef		INTERNAL_TYPES::u32			Iteration;			// The number of the current iteration; 0 is never used
+
+	private:
+		struct Entry {
+			State								theState;			// The state in this slot
+			PDDL::Number						theCost;			// The cost of the cheapest plan which reached theState during theIteration
+			Iteration							theIteration;		// The iteration which stored theState; this entry is empty when it is not the current iteration
+		};
+
+
+	// ----- Properties
+	private:
+		std::vector<Entry>						theEntries;			// The slots of the table; their number is a power of 2, or 0 when the table is disabled
+		size_type								theMask;			// theEntries.size() - 1
+		Iteration								theIteration;		// The current iteration
+
+
+	// ----- Constructors
+	public:
+		explicit TranspositionTable(size_type someSlots);		// someSlots is rounded down to a power of 2; 0 disables the table
+
+
+	// ----- Accessors
+	public:
+		inline size_type Size() const { return (size_type) theEntries.size(); }
+
+
+	// ----- Operations
+	public:
+		void NextIteration();				// Forget all the states stored so far
+
+		// True when aState has already been reached during this iteration with a cost lower or equal to aCost;
+		// otherwise, remember that aState has been reached with aCost and return false
+		bool Prune(const State& aState, PDDL::Number aCost);
+
+		size_t SizeOf() const;
+};
+
+#endif	// _SPHG_PLANNER_TRANSPOSITION_TABLE_H
+// ================================================================================================ End of file "TranspositionTable.h"
@@ -0,0 +1,225 @@
+// ================================================================================================ Beginning of file "bset.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ================================================================================================ File Content
+//
+// This file contains the following sections and subsections:
+//  - Inclusion of files
+//	- Namespace declaration
+//	- Comments
+//	- Class declaration
+//
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_TOOLS_BSET_H
+#define _SPHG_TOOLS_BSET_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler
+#endif					// _MSC_VER
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+#if !defined(_MSC_VER) || (_MSC_VER >= 1600)	// At least Microsoft Visual Studio 2010 or something else (e.g. g++)
+	#include <cstdint>							// Visibility for uint64_t
+#endif
+
+#if defined(_MSC_VER)
+	#include <intrin.h>							// Visibility for _BitScanForward64
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+	#define SPHG_BSET_SSE2
+	#include <emmintrin.h>						// Visibility for the SSE2 128 bits integer operations
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Namespace declaration
+//
+namespace SPHG		{	// Simple Planning, Happy Gaming!
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Comments
+//
+// The purpose of this file is to provide a template class implementing fixed width sets of
+// unsigned integers, very much like SPHG::uset (cf. file "uset.h"), but where:
+//		- a slot is an unsigned 64 bit integer (instead of an unsigned 32 bit integer)
+//		- whole sets are combined slot by slot: difference (AND-NOT), union (OR), inclusion and
+//			equality tests, so that a set is never scanned element by element for these operations
+//
+//	.As an example, assume the following declaration:
+//
+//			SPHG::bset<unsigned char, 4>   my_bset;
+//
+//		Then my_bset is a subset of the range [0, 255 (== (64 * 4) - 1)] stored in 4 * 8 = 32 bytes.
+//
+//	.A bset has no pointer and no heap memory: copying a bset is copying cardinal 64 bit integers.
+//
+//	.first/0 and next/1 return an unsigned int (and not N) so that the end of a set, i.e.
+//		(cardinal * 64), can always be represented; when N is unsigned char and cardinal is 4,
+//		the end of the set is 256 which an unsigned char cannot represent.
+//
+//	.When SSE2 is available, includes/1 (e.g. the goal test of a search) compares two slots at a time.
+//
+// ------------------------------------------------------------------------------------------------
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////// Class declaration
+//
+template <class N, unsigned char cardinal> class bset {
+	// ----- Constants
+	// Changing the value of one of the following IMPLIES changing the value of the other
+	#define	NUMBER_OF_BITS_PER_SLOT		64		// == (number of bits of uint64_t) == 64
+	#define SLOT_EXPONENT				6		// NUMBER_OF_BITS_PER_SLOT == 64 == 2^6 == 2^SLOT_EXPONENT
+
+
+	// ----- Types
+	public:
+		typedef	N				size_type;
+		typedef	unsigned int	index_type;		// Can represent (cardinal * 64), the end of the set
+		typedef	uint64_t		slot_type;
+
+
+	// ----- Properties
+	private:
+		slot_type		theSet[cardinal];
+
+
+	// ----- Constructors
+	public:
+		bset() { clear(); }
+
+
+	// ----- Accessors
+	public:
+		static inline index_type end() { return (index_type) (cardinal << SLOT_EXPONENT); }
+		static inline unsigned char slots() { return cardinal; }
+		inline slot_type slot(unsigned char s) const { return theSet[s]; }
+
+
+	// ----- Operations
+	public:
+		inline void clear() {
+			for (unsigned char s = 0; s < cardinal; ++s)
+				theSet[s] = 0;
+		}
+		inline bool empty() const {
+			for (unsigned char s = 0; s < cardinal; ++s)
+				if (0 != theSet[s])
+					return false;
+			return true;
+		}
+		inline index_type first() const {
+			return next_from(0);
+		}
+		inline index_type next(index_type element) const {
+			// !!! next/1 doesn't check whether element is part of this set !!!
+			return next_from(element + 1);
+		}
+		inline size_type size() const {
+			// Compute the number of elements in this set, one slot at a time
+			size_type theSize = 0;
+			for (unsigned char s = 0; s < cardinal; ++s)
+				theSize += (size_type) popcount(theSet[s]);
+			return theSize;
+		}
+		inline bool find(const N element) const {
+			// !!! find/1 doesn't check whether element is part of this set !!!
+			return ((theSet[element >> SLOT_EXPONENT] >> (element & (NUMBER_OF_BITS_PER_SLOT - 1))) & 1);
+		}
+		inline void insert(const N element) {
+			// !!! insert/1 doesn't check whether element is part of this set !!!
+			theSet[element >> SLOT_EXPONENT] |= ((slot_type) 1 << (element & (NUMBER_OF_BITS_PER_SLOT - 1)));
+		}
+		inline void erase(const N element) {
+			// !!! erase/1 doesn't check whether element is part of this set !!!
+			theSet[element >> SLOT_EXPONENT] &= ~((slot_type) 1 << (element & (NUMBER_OF_BITS_PER_SLOT - 1)));
+		}
+
+		// Whole set operations
+		inline void remove(const bset& right) {
+			// this = this \ right
+			for (unsigned char s = 0; s < cardinal; ++s)
+				theSet[s] &= ~right.theSet[s];
+		}
+		inline void add(const bset& right) {
+			// this = this U right
+			for (unsigned char s = 0; s < cardinal; ++s)
+				theSet[s] |= right.theSet[s];
+		}
+		inline bool includes(const bset& right) const {
+			// Is right a subset of this? i.e. ((this & right) == right)
+			unsigned char s = 0;
+#if defined(SPHG_BSET_SSE2)
+			for (; (s + 1) < cardinal; s += 2)
+			{
+				__m128i l = _mm_loadu_si128((const __m128i*) (theSet + s));
+				__m128i r = _mm_loadu_si128((const __m128i*) (right.theSet + s));
+				if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(l, r), r)))
+					return false;
+			}
+#endif
+			for (; s < cardinal; ++s)
+				if ((theSet[s] & right.theSet[s]) != right.theSet[s])
+					return false;
+			return true;
+		}
+		inline bool intersects(const bset& right) const {
+			for (unsigned char s = 0; s < cardinal; ++s)
+				if (0 != (theSet[s] & right.theSet[s]))
+					return true;
+			return false;
+		}
+		inline bool operator==(const bset& right) const {
+			for (unsigned char s = 0; s < cardinal; ++s)
+				if (theSet[s] != right.theSet[s])
+					return false;
+			return true;
+		}
+		inline bool operator!=(const bset& right) const { return !(*this == right); }
+
+	private:
+		inline index_type next_from(index_type element) const {
+			// Return the smallest element of this set which is greater or equal to element; end/0 when there is none
+			unsigned char s = (unsigned char) (element >> SLOT_EXPONENT);
+			if (s >= cardinal)
+				return end();
+
+			// Forget the bits below element in its slot, then jump over the empty slots
+			slot_type w = theSet[s] & (~(slot_type) 0 << (element & (NUMBER_OF_BITS_PER_SLOT - 1)));
+			while (0 == w)
+			{
+				if (++s == cardinal)
+					return end();
+				w = theSet[s];
+			}
+
+			return (((index_type) s << SLOT_EXPONENT) + lowest(w));
+		}
+		static inline index_type lowest(slot_type w) {
+			// Position of the lowest bit set to 1 in w (w != 0)
+#if defined(_MSC_VER) && defined(_M_X64)
+			unsigned long p;
+			_BitScanForward64(&p, w);
+			return (index_type) p;
+#elif defined(__GNUC__)
+			return (index_type) __builtin_ctzll(w);
+#else
+			index_type p = 0;
+			while (0 == (w & 1)) { w >>= 1; ++p; }
+			return p;
+#endif
+		}
+		static inline index_type popcount(slot_type w) {
+#if defined(__GNUC__)
+			return (index_type) __builtin_popcountll(w);
+#else
+			index_type c = 0;
+			for (; 0 != w; w &= (w - 1))
+				++c;
+			return c;
+#endif
+		}
+};
+
+}						// End of Namespace SPHG (Simple Planning, Happy Gaming)
+#endif					// _SPHG_TOOLS_BSET_H
+// ================================================================================================ End of file "bset.h"
\ No newline at end of file
@@ -1,274 +1,487 @@
-// ================================================================================================ Beginning of file "main_BCP.cpp"
-// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
-/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
-//
-//	This file contains the code for the following target of the BCP planning component:
-//		- Console Application where planning data input is from PDDL files
-//
-///////////////////////////////////////////////////////////////////////////////////////////////////
-//
-/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
-//
-#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
-	#include "ConditionalCompiling.h"	// Visibility for BCP_TARGET, BUILD, DLL, TEST and C_SHARP_INTERFACE
-#endif
-//
-/////////////////////////////////////////////////////////////////////////////////////////////////// Console Application
-//
-//                           C O N S O L E     A P P L I C A T I O N
-//
-///////////////////////////////////////////////////////////////////////////////////////////////////
-//
-// Files included for the Console Application target
-#ifndef _DOMAIN_FILE_H
-	#include "DomainFile.h"
-#endif
-
-#ifndef _SPHG_PLANNER_PLAN_H
-	#include "Plan.h"
-#endif
-
-#ifndef _SPHG_PDDL_PROBLEM_FILE_H
-	#include "ProblemFile.h"
-#endif
-
-#ifndef _SPHG_TOOLS_RUNTIMES_H
-	#include "Runtimes.h"
-#endif
-
-#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
-	#include "StateSpaceForwardChaining.h"
-#endif
-
-
-// ************************************************************************************************
-//
-//	                             R E T U R N E D     V A L U E S
-//
-// ------------------------------------------------------------------------------------------------
-//
-#define HELP							   -1;		// Somebody asked for information about the application
-
-#define SEARCH_IS_NOT_NEEDED				0;		// The :goal in the PDDL Problem file is declared included in the :init
-#define	SEARCH_STOPS_FOUND_A_SOLUTION		1;		// Plan is at least 1 action long
-#define SEARCH_ENDS_WITH_NO_SOLUTION		2;		// Empty plan
-
-#define	ERROR_READING_DOMAIN_FILE			11;		// PDDL Domain file must be fixed
-#define	ERROR_READING_PROBLEM_FILE			12;		// PDDL Problem file must be fixed
-#define ERROR_UNKNOWN_OPTION				13;		// See next comments on Command-Line Options for available options
-#define ERROR_DASH_PREFIX_MISSING			14;		// The '-' prefix is missing before an option
-#define ERROR_WRONG_NUMBER_OF_ARGUMENTS		15;		// Correct number of arguments is 1, 2, 3 or 4 (we don't count argv[0] cf. line 79 or line 221))
-
-
-// ************************************************************************************************
-//
-//							C O M M A N D - L I N E		O P T I O N S 
-//
-// ------------------------------------------------------------------------------------------------
-//
-//		-h		// prints some help about this application
-//		-help	// prints some help about this application
-//		-m		// prints some measures on the memory use
-//		-r		// prints the reading of both the PDDL Domain and Problem runtimes and SEARCH runtime
-//
-int main(int argc, char* argv[]) {
-
-	if ((3 <= argc) && (argc <= 5))
-	{
-		// When the number of arguments is between 3 (from 0 to 2) and 5 (from 0 to 4):
-		//	- argv[0] contains the full path to the executable file (i.e. the ".exe") of this application
-		//	- argv[1] contains the full path to the PDDL Domain file
-		//	- argv[2] contains the full path to the PDDL Problem file
-		//	- argv[3] may contain a command-line option
-		//	- argv[4] may contain a command-line option
-
-		// Check the options first
-		bool options[2] = {false /* -m */, false /* -r */};		// Note the alphabetical order between the options the user can activate
-		for (unsigned char i = 3; i < argc;)
-		{
-			if ('-' == argv[i][0])
-				switch (argv[i][1])
-				{	// Following cases are in alphabetical order
-					case 'm':
-						{
-							options[0] = true;
-							++i;
-							break;
-						}
-					case 'r':
-						{
-							// This option only toggles the printing of runtimes (see calls to RT.Start() and RT.Stop() below);
-							options[1] = true;
-							++i;
-							break;
-						}
-					default:
-						{
-							std::cerr << "Option -" << argv[i][1] << " is unknown." << std::endl;
-
-							return ERROR_UNKNOWN_OPTION;
-						}
-				}
-			else // ('-' != argv[i][0])
-			{
-				std::cerr << "Option " << argv[i] << " must be preceded by '-'." << std::endl;
-
-				return ERROR_DASH_PREFIX_MISSING;
-			}
-		}
-
-		// 3 runtimes shall be measured:
-		//		RT[0] <=> How long was the reading the PDDL Domain file?
-		//		RT[1] <=> How long was the reading the PDDL Problem file?
-		//		RT[2] <=> How long was the searching for a solution plan?
-#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
-		SPHG::Runtimes_T_hrc<3> RT;
-#else					// When it's not MSVC++ and maybe not under windows (e.g. unix)
-		SPHG::Runtimes_T_clock_t<3> RT;
-#endif					// _MSC_VER
-		if (options[1] /* -r */)
-		{
-			// Set up the output format of the time measures
-			std::cout.setf(std::ios_base::fixed /* fixed-decimal notation */, std::ios_base::floatfield /* fixed || scientific (with exponent field) */);
-			std::cout.precision(RT.Precision() + 1);
-		}
-
-		Domain::StoreHouse thePDDLLocalStore;	// The Planning store house: domains, problems, searches, ...
-
-		// Runtime of the reading of the PDDL Domain file is always measured...
-		RT.Start();
-		DomainFile df(argv[1] /* The Domain filename is the first argument */, thePDDLLocalStore);
-		RT.Stop();
-
-		// ... but printed ONLY WHEN the corresponding option is ON
-		if (options[1] /* -r */)
-			std::cout << "Reading of the PDDL Domain file took " << RT.Runtime(0) << " second(s)." << std::endl;
- 
-		// Check whether the PDDL Domain file has been correctly read
-		if (0 == thePDDLLocalStore.size() || df.ReadingFailed())
-		{
-			std::cerr << "PDDL Domain file " << argv[1] << " is incorrect." << std::endl;
-
-			return ERROR_READING_DOMAIN_FILE;
-		}
-
-		if (options[0] /* -m */) df.SizeOf();
-
-		// Runtime of the reading of the PDDL Problem file is always measured...
-		RT.Start();
-		ProblemFile pf(argv[2], thePDDLLocalStore, df.ReadingFailed());
-		RT.Stop();
-
-		// Check whether the PDDL Problem file has been correctly read
-		if (pf.ReadingFailed())
-		{
-			std::cerr << "PDDL Problem file " << argv[2] << " is incorrect." << std::endl;
-
-			return ERROR_READING_PROBLEM_FILE;
-		}
-
-		// Register the correct PDDL problem file
-		Domain::HProblem pb = df.AddProblem(pf);
-
-		// ... but printed ONLY WHEN the PDDL Problem file is correct and the corresponding option is ON
-		if (options[1] /* -r */)
-			std::cout << "Reading of the PDDL Problem file took " << RT.Runtime(1) << " second(s)." << std::endl;
-
-		if (options[0] /* -m */) (df.GettheProblem(0))->SizeOf(argv[2]);
-
-		if (pf.SearchUnneeded())
-		{
-			std::cout << "No search is needed: PDDL Problem file " << argv[2] << " declares a trivial problem." << std::endl;
-
-			return SEARCH_IS_NOT_NEEDED;
-		}
-		else // (! pf.SearchUnneeded())
-		{
-			// Create the structure for the search
-			StateSpaceForwardChaining s(df, pb);
-
-			// Search runtime is ALWAYS measured...
-			RT.Start();
-			bool aSolutionWasFound = s.BreadthFirst(options[0]);
-			// bool aSolutionWasFound = s.BestFirst();
-			RT.Stop();
-
-			// Search runtime is ALWAYS measured... but printed ONLY WHEN the corresponding option is ON
-			if (options[1] /* -r */)
-				std::cout << "Planning took " << RT.Runtime(2) << " second(s)." << std::endl;
-
-			// Always print memory consumption during search (tells us the number of predicates)
-			std::cout << "Total memory size is greater than " << s.SizeOf() << " bytes." << std::endl << std::endl;
-		
-			// Print search results
-			if (aSolutionWasFound)
-			{
-				s.Put(std::cout /* Where to print */, s.GetthePlanFound(), "    " /* Tabulation to align :actions*/);
-
-				return SEARCH_STOPS_FOUND_A_SOLUTION;
-			}
-			else // (! aSolutionWasFound) <=> search found no solution
-			{
-				std::cout << "No solution found." << std::endl;
-
-				return SEARCH_ENDS_WITH_NO_SOLUTION;
-			}
-		}
-	}
-	else if (2 == argc)
-	{
-		// When this console application receives 2 arguments:
-		//	- argv[0] contains the full path to the executable file (i.e. ".exe") of this application
-		//  - argv[1] contains the help option
-		
-		PDDL::Identifier Option = argv[1];
-		if (("-h" == Option) || ("-help" == Option))
-		{
-			std::cout << std::endl
-				<< "The command-line for this application is:" << std::endl
-				<< "  \"Planner  a_PDDL_Domain_FileName  a_PDDL_Problem_Filename  [-m][-r]\"" << std::endl
-				<< "Option -m prints memory usage (domain, problem and search)." << std::endl
-				<< "Option -r prints runtimes (reading of the domain and problem PDDL files, and search)." << std::endl
-				<< "This Planner accepts the following PDDL :requirements (in alphabetical order):" << std::endl
-				<< "   - :action-costs" << std::endl
-				<< "   - :negative-preconditions" << std::endl
-				<< "   - :strips" << std::endl
-				<< "   - :types (although types are accepted in a PDDL file, they are ignored)" << std::endl
-				<< std::endl;
-
-			return HELP;
-		}
-		else // (("-h" != Option) && ("-help" != Option))
-		{
-			std::cerr << "Option " << Option << " is unknown." << std::endl;
-
-			return ERROR_UNKNOWN_OPTION;
-		}
-	}
-	else // ((argc < 2) || (5 < argc))
-	{
-		std::cerr << "Incorrect number of arguments: " << (argc - 1) /* Don't count argv[0] (cf. line 79 or line 221) */ << "." << std::endl;
-
-		std::cerr << std::endl
-			<< "The command-line for this application is:" << std::endl
-			<< "  \"Planner  a_PDDL_Domain_FileName  a_PDDL_Problem_Filename  [-m][-r]\"" << std::endl
-			<< "Option -m prints memory usage (domain, problem and search)." << std::endl
-			<< "Option -r prints runtimes (reading of the domain and problem PDDL files, and search)." << std::endl
-			<< "This Planner accepts the following PDDL :requirements (in alphabetical order):" << std::endl
-			<< "   - :action-costs" << std::endl
-			<< "   - :negative-preconditions" << std::endl
-			<< "   - :strips" << std::endl
-			<< "   - :types (although this application accepts types in a PDDL file, they are ignored)" << std::endl
-			<< std::endl;
-
-		return ERROR_WRONG_NUMBER_OF_ARGUMENTS;
-	}
-}
-//
-//
-//
-///////////////////////////////////////////////////////////////////////////////////////////////////
-//
-//
-//
+// ================================================================================================ Beginning of file "main_BCP.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+/////////////////////////////////////////////////////////////////////////////////////////////////// File Content
+//
+//	This file contains the code for the following target of the BCP planning component:
+//		- Console Application where planning data input is from PDDL files
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Inclusion of files
+//
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"	// Visibility for BCP_TARGET, BUILD, DLL, TEST and C_SHARP_INTERFACE
+#endif
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////// Console Application
+//
+//                           C O N S O L E     A P P L I C A T I O N
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Files included for the Console Application target
+#include <stdlib.h>					// Visibility for atoi/1
+
+#ifndef _DOMAIN_FILE_H
+	#include "DomainFile.h"
+#endif
+
+#ifndef _SPHG_PLANNER_PLAN_H
+	#include "Plan.h"
+#endif
+
+#ifndef _SPHG_PLANNER_PORTFOLIO_H
+	#include "Portfolio.h"
+#endif
+
+#ifndef _SPHG_PDDL_PROBLEM_FILE_H
+	#include "ProblemFile.h"
+#endif
+
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+	#include "RunSearch.h"
+#endif
+
+#ifndef _SPHG_TOOLS_RUNTIMES_H
+	#include "Runtimes.h"
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"
+#endif
+
+
+// ************************************************************************************************
+//
+//	                             R E T U R N E D     V A L U E S
+//
+// ------------------------------------------------------------------------------------------------
+//
+#define HELP							   -1;		// Somebody asked for information about the application
+
+#define SEARCH_IS_NOT_NEEDED				0;		// The :goal in the PDDL Problem file is declared included in the :init
+#define	SEARCH_STOPS_FOUND_A_SOLUTION		1;		// Plan is at least 1 action long
+#define SEARCH_ENDS_WITH_NO_SOLUTION		2;		// Empty plan
+#define SEARCH_RAN_OUT_OF_BUDGET			3;		// The budget of options -b, -e or -t was spent first: the partial plan closest to the goal is printed
+
+#define	ERROR_READING_DOMAIN_FILE			11;		// PDDL Domain file must be fixed
+#define	ERROR_READING_PROBLEM_FILE			12;		// PDDL Problem file must be fixed
+#define ERROR_UNKNOWN_OPTION				13;		// See next comments on Command-Line Options for available options
+#define ERROR_DASH_PREFIX_MISSING			14;		// The '-' prefix is missing before an option
+#define ERROR_WRONG_NUMBER_OF_ARGUMENTS		15;		// Correct number of arguments is 1, or 2 to 18 (we don't count argv[0], cf. main/2)
+#define ERROR_UNKNOWN_SEARCH				16;		// See next comments on Command-Line Options for available searches
+#define ERROR_WRONG_NUMBER_OF_THREADS		17;		// Option -j must be followed by a positive number of threads
+#define ERROR_WRONG_BUDGET					18;		// Options -b, -e and -t must be followed by a positive number
+
+
+// ************************************************************************************************
+//
+//							C O M M A N D - L I N E		O P T I O N S 
+//
+// ------------------------------------------------------------------------------------------------
+//
+//		-b n	// stops the search when its states, nodes and frontiers use more than n megabytes
+//		-d		// stores the states of the search as deltas to their parents: less memory, as each state is rebuilt when it is needed (the threads of the hda searches store full states)
+//		-e n	// stops the search after n expansions
+//		-h		// prints some help about this application
+//		-help	// prints some help about this application
+//		-g		// grounds the operators of the domain before search
+//		-j n	// runs the parallel searches with n threads (default: as many threads as the hardware runs concurrently)
+//		-m		// prints some measures on the memory use
+//		-o		// disables the symmetry reduction of the grounded searches (cf. -g): the states only differing by interchangeable objects are all explored
+//		-p		// disables the partial-order reduction (strong stubborn sets) of the grounded searches (cf. -g): every interleaving of independent actions is explored
+//		-r		// prints the reading of both the PDDL Domain and Problem runtimes and SEARCH runtime
+//		-t n	// stops the search after n milliseconds (the grounding of the operators is not counted)
+//		-s name	// selects the search, where name is one of:
+//					breadth		// breadth first search (default)
+//					best		// cheapest-action-cost-first search
+//					astar-hmax	// A* search with the h_max heuristic (grounds the operators of the domain)
+//					astar-lmcut	// A* search with the LM-cut heuristic (grounds the operators of the domain)
+//					gbfs-ff		// greedy best first search with the FF heuristic and its preferred actions (grounds the operators of the domain)
+//					iddfs		// iterative deepening depth first search on the cost of the plans, keeping no closed list
+//					idastar-hmax	// IDA* search with the h_max heuristic, keeping no closed list (grounds the operators of the domain)
+//					idastar-lmcut	// IDA* search with the LM-cut heuristic, keeping no closed list (grounds the operators of the domain)
+//					bidirectional	// breadth first search forward from the initial state and backward from the goal, until they meet (grounds the operators of the domain)
+//					parallel-breadth	// breadth first search expanding each depth with several threads; same plan as breadth (grounds the operators of the domain)
+//					hda-best		// hash distributed cheapest-plan-cost-first search with several threads (grounds the operators of the domain)
+//					hdastar-hmax	// hash distributed A* search with the h_max heuristic and several threads (grounds the operators of the domain)
+//					hdastar-lmcut	// hash distributed A* search with the LM-cut heuristic and several threads (grounds the operators of the domain)
+//					portfolio		// breadth, best, gbfs-ff, astar-lmcut and bidirectional searches at once, on separate threads; the first plan found is printed
+//
+int main(int argc, char* argv[]) {
+
+	if ((3 <= argc) && (argc <= 19))
+	{
+		// When the number of arguments is between 3 (from 0 to 2) and 19 (from 0 to 18):
+		//	- argv[0] contains the full path to the executable file (i.e. the ".exe") of this application
+		//	- argv[1] contains the full path to the PDDL Domain file
+		//	- argv[2] contains the full path to the PDDL Problem file
+		//	- argv[3] to argv[18] may contain command-line options (options -b, -e, -j and -t are followed by a number, option -s by the name of a search: 16 arguments when each option is given once)
+
+		// Check the options first
+		bool options[6] = {false /* -d */, false /* -g */, false /* -m */, false /* -o */, false /* -p */, false /* -r */};		// Note the alphabetical order between the options the user can activate
+		PDDL::Identifier aSearch = "breadth";										// The name of the search (-s)
+		unsigned int theThreads = 0;												// The number of threads of the parallel searches (-j); 0 lets the search choose
+		StateSpaceForwardChaining::Budget aBudget;									// The limits of the search (-b, -e and -t); no limit by default
+		for (unsigned char i = 3; i < argc;)
+		{
+			if ('-' == argv[i][0])
+				switch (argv[i][1])
+				{	// Following cases are in alphabetical order
+					case 'b':
+					case 'e':
+					case 't':
+						{
+							if (((i + 1) >= argc) || (0 >= atoi(argv[i + 1])))
+							{
+								std::cerr << "Option -" << argv[i][1] << " must be followed by a positive number." << std::endl;
+
+								return ERROR_WRONG_BUDGET;
+							}
+							if ('b' == argv[i][1])
+								aBudget.theBytes = (size_t) atoi(argv[i + 1]) * 1024 * 1024;
+							else if ('e' == argv[i][1])
+								aBudget.theExpansions = (INTERNAL_TYPES::u32) atoi(argv[i + 1]);
+							else // ('t' == argv[i][1])
+								aBudget.theMicroseconds = (INTERNAL_TYPES::u64) atoi(argv[i + 1]) * 1000;
+							i += 2;
+							break;
+						}
+					case 'd':
+						{
+							options[0] = true;
+							++i;
+							break;
+						}
+					case 'g':
+						{
+							options[1] = true;
+							++i;
+							break;
+						}
+					case 'j':
+						{
+							if (((i + 1) >= argc) || (0 >= atoi(argv[i + 1])))
+							{
+								std::cerr << "Option -j must be followed by a positive number of threads." << std::endl;
+
+								return ERROR_WRONG_NUMBER_OF_THREADS;
+							}
+							theThreads = (unsigned int) atoi(argv[i + 1]);
+							i += 2;
+							break;
+						}
+					case 'm':
+						{
+							options[2] = true;
+							++i;
+							break;
+						}
+					case 'o':
+						{
+							options[3] = true;
+							++i;
+							break;
+						}
+					case 'p':
+						{
+							options[4] = true;
+							++i;
+							break;
+						}
+					case 'r':
+						{
+							// This option only toggles the printing of runtimes (see calls to RT.Start() and RT.Stop() below);
+							options[5] = true;
+							++i;
+							break;
+						}
+					case 's':
+						{
+							if ((i + 1) >= argc)
+							{
+								std::cerr << "Option -s must be followed by the name of a search." << std::endl;
+
+								return ERROR_UNKNOWN_SEARCH;
+							}
+							aSearch = argv[i + 1];
+							if (("breadth" != aSearch) && ("best" != aSearch) && ("astar-hmax" != aSearch) && ("astar-lmcut" != aSearch) && ("gbfs-ff" != aSearch)
+								&& ("iddfs" != aSearch) && ("idastar-hmax" != aSearch) && ("idastar-lmcut" != aSearch) && ("bidirectional" != aSearch) && ("parallel-breadth" != aSearch)
+								&& ("hda-best" != aSearch) && ("hdastar-hmax" != aSearch) && ("hdastar-lmcut" != aSearch) && ("portfolio" != aSearch))
+							{
+								std::cerr << "Search " << aSearch << " is unknown." << std::endl;
+
+								return ERROR_UNKNOWN_SEARCH;
+							}
+							i += 2;
+							break;
+						}
+					default:
+						{
+							std::cerr << "Option -" << argv[i][1] << " is unknown." << std::endl;
+
+							return ERROR_UNKNOWN_OPTION;
+						}
+				}
+			else // ('-' != argv[i][0])
+			{
+				std::cerr << "Option " << argv[i] << " must be preceded by '-'." << std::endl;
+
+				return ERROR_DASH_PREFIX_MISSING;
+			}
+		}
+
+		// 3 runtimes shall be measured:
+		//		RT[0] <=> How long was the reading the PDDL Domain file?
+		//		RT[1] <=> How long was the reading the PDDL Problem file?
+		//		RT[2] <=> How long was the searching for a solution plan?
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+		SPHG::Runtimes_T_hrc<3> RT;
+#else					// When it's not MSVC++ and maybe not under windows (e.g. unix)
+		SPHG::Runtimes_T_clock_t<3> RT;
+#endif					// _MSC_VER
+		if (options[5] /* -r */)
+		{
+			// Set up the output format of the time measures
+			std::cout.setf(std::ios_base::fixed /* fixed-decimal notation */, std::ios_base::floatfield /* fixed || scientific (with exponent field) */);
+			std::cout.precision(RT.Precision() + 1);
+		}
+
+		Domain::StoreHouse thePDDLLocalStore;	// The Planning store house: domains, problems, searches, ...
+
+		// Runtime of the reading of the PDDL Domain file is always measured...
+		RT.Start();
+		DomainFile df(argv[1] /* The Domain filename is the first argument */, thePDDLLocalStore);
+		RT.Stop();
+
+		// ... but printed ONLY WHEN the corresponding option is ON
+		if (options[5] /* -r */)
+			std::cout << "Reading of the PDDL Domain file took " << RT.Runtime(0) << " second(s)." << std::endl;
+ 
+		// Check whether the PDDL Domain file has been correctly read
+		if (0 == thePDDLLocalStore.size() || df.ReadingFailed())
+		{
+			std::cerr << "PDDL Domain file " << argv[1] << " is incorrect." << std::endl;
+
+			return ERROR_READING_DOMAIN_FILE;
+		}
+
+		if (options[2] /* -m */) df.SizeOf();
+
+		// Runtime of the reading of the PDDL Problem file is always measured...
+		RT.Start();
+		ProblemFile pf(argv[2], thePDDLLocalStore, df.ReadingFailed());
+		RT.Stop();
+
+		// Check whether the PDDL Problem file has been correctly read
+		if (pf.ReadingFailed())
+		{
+			std::cerr << "PDDL Problem file " << argv[2] << " is incorrect." << std::endl;
+
+			return ERROR_READING_PROBLEM_FILE;
+		}
+
+		// Register the correct PDDL problem file
+		Domain::HProblem pb = df.AddProblem(pf);
+
+		// ... but printed ONLY WHEN the PDDL Problem file is correct and the corresponding option is ON
+		if (options[5] /* -r */)
+			std::cout << "Reading of the PDDL Problem file took " << RT.Runtime(1) << " second(s)." << std::endl;
+
+		if (options[2] /* -m */) (df.GettheProblem(0))->SizeOf(argv[2]);
+
+		if (pf.SearchUnneeded())
+		{
+			std::cout << "No search is needed: PDDL Problem file " << argv[2] << " declares a trivial problem." << std::endl;
+
+			return SEARCH_IS_NOT_NEEDED;
+		}
+		else // (! pf.SearchUnneeded())
+		{
+			// Create the structure for the search
+			StateSpaceForwardChaining s(df, pb);
+			s.SetBudget(aBudget);
+			s.SetStubbornSets(! options[4] /* -p */);
+			s.SetSymmetries(! options[3] /* -o */);
+			s.SetCompressedStates(options[0] /* -d */);
+
+			// The portfolio creates the structures of its own searches; the plan printed is then the one of its winner
+			Portfolio aPortfolio(df, pb);
+			StateSpaceForwardChaining* theSSFC = &s;
+			PDDL::Identifier theSearchFound = aSearch;
+
+			// The searches needing the grounded operators run as best (with a heuristic) or breadth (without) when the grounding stops
+			const bool aHeuristicIsNeeded = ((0 == aSearch.compare(0, 5, "astar")) || (0 == aSearch.compare(0, 7, "idastar")) || (0 == aSearch.compare(0, 4, "gbfs")) || (0 == aSearch.compare(0, 3, "hda")));
+			const bool theGroundedOperatorsAreNeeded = NeedstheGroundedOperators(aSearch);
+
+			// Search runtime is ALWAYS measured (and includes the grounding of the operators)...
+			RT.Start();
+			bool theOperatorsAreGrounded = false;
+			if (options[1] /* -g */ || theGroundedOperatorsAreNeeded)
+			{
+				theOperatorsAreGrounded = s.Ground();
+				if (! theOperatorsAreGrounded)
+				{
+					std::cout << "Grounding stopped: more than " << MAXIMUM_NUMBER_OF_PREDICATES << " predicates are reachable; the search uses the operators of the domain." << std::endl;
+					if (theGroundedOperatorsAreNeeded)
+						std::cout << "Search " << aSearch << " needs the grounded operators: the search is " << (aHeuristicIsNeeded ? "best" : "breadth") << " instead." << std::endl;
+				}
+			}
+			bool aSolutionWasFound = false;
+			if ("portfolio" == aSearch)
+			{
+				const char* someSearches[] = {"breadth", "best", "gbfs-ff", "astar-lmcut", "bidirectional"};
+				for (unsigned char e = 0; e < sizeof(someSearches) / sizeof(someSearches[0]); ++e)
+					if (aPortfolio.Add(someSearches[e]))
+					{
+						aPortfolio.GettheSSFC(aPortfolio.Size() - 1).SetBudget(aBudget);
+						aPortfolio.GettheSSFC(aPortfolio.Size() - 1).SetStubbornSets(! options[4] /* -p */);
+						aPortfolio.GettheSSFC(aPortfolio.Size() - 1).SetSymmetries(! options[3] /* -o */);
+						aPortfolio.GettheSSFC(aPortfolio.Size() - 1).SetCompressedStates(options[0] /* -d */);
+					}
+				aSolutionWasFound = aPortfolio.Run();
+				if (aSolutionWasFound)
+				{
+					theSSFC = &aPortfolio.GettheSSFC(aPortfolio.GettheWinner());
+					theSearchFound = aPortfolio.GettheSearch(aPortfolio.GettheWinner());
+					std::cout << "Search " << theSearchFound << " found a plan first." << std::endl;
+				}
+				else // Keep the partial plan closest to the goal among the searches which ran out of budget
+					for (Portfolio::HEngine e = 0; e < aPortfolio.Size(); ++e)
+					{
+						StateSpaceForwardChaining& anSSFC = aPortfolio.GettheSSFC(e);
+						if ((StateSpaceForwardChaining::SEARCH_BUDGET_EXHAUSTED == anSSFC.GettheStatus())
+							&& ((&s == theSSFC) || (anSSFC.GettheMissingGoals() < theSSFC->GettheMissingGoals())))
+						{
+							theSSFC = &anSSFC;
+							theSearchFound = aPortfolio.GettheSearch(e);
+						}
+					}
+			}
+			else if (("breadth" == aSearch) || (theGroundedOperatorsAreNeeded && !theOperatorsAreGrounded && !aHeuristicIsNeeded))
+				aSolutionWasFound = s.BreadthFirst(options[2]);
+			else
+			{
+				aSolutionWasFound = RunSearch(s, (theGroundedOperatorsAreNeeded && !theOperatorsAreGrounded) ? "best" : aSearch, theThreads);
+
+				if ((0 == aSearch.compare(0, 3, "hda")) && theOperatorsAreGrounded)
+					for (std::vector<INTERNAL_TYPES::u32>::size_type t = 0; t < s.GettheExpansionsPerThread().size(); ++t)
+						std::cout << "Thread #" << t << " expanded " << s.GettheExpansionsPerThread()[t] << " states." << std::endl;
+			}
+			RT.Stop();
+
+			// Search runtime is ALWAYS measured... but printed ONLY WHEN the corresponding option is ON
+			if (options[5] /* -r */)
+				std::cout << "Planning took " << RT.Runtime(2) << " second(s)." << std::endl;
+
+			// Always print memory consumption during search (tells us the number of predicates)
+			std::cout << "Total memory size is greater than " << (("portfolio" == aSearch) ? aPortfolio.SizeOf() : s.SizeOf()) << " bytes." << std::endl << std::endl;
+		
+			// Print search results
+			if (aSolutionWasFound)
+			{
+				theSSFC->Put(std::cout /* Where to print */, theSSFC->GetthePlanFound(), "    " /* Tabulation to align :actions*/);
+				if (("breadth" != theSearchFound) && ("parallel-breadth" != theSearchFound))
+					std::cout << "The cost of this plan is " << theSSFC->GettheCostOfthePlanFound() << "." << std::endl;
+
+				return SEARCH_STOPS_FOUND_A_SOLUTION;
+			}
+			else if (StateSpaceForwardChaining::SEARCH_BUDGET_EXHAUSTED == theSSFC->GettheStatus())
+			{
+				std::cout << "Search " << theSearchFound << " ran out of budget after " << theSSFC->GettheExpansions() << " expansions; the closest state to the goal misses "
+						  << theSSFC->GettheMissingGoals() << " of its predicates:" << std::endl;
+				theSSFC->Put(std::cout /* Where to print */, theSSFC->GetthePartialPlan(), "    " /* Tabulation to align :actions*/);
+				if (("breadth" != theSearchFound) && ("parallel-breadth" != theSearchFound))
+					std::cout << "The cost of this partial plan is " << theSSFC->GettheCostOfthePartialPlan() << "." << std::endl;
+
+				return SEARCH_RAN_OUT_OF_BUDGET;
+			}
+			else // (! aSolutionWasFound) <=> search found no solution
+			{
+				std::cout << "No solution found." << std::endl;
+
+				return SEARCH_ENDS_WITH_NO_SOLUTION;
+			}
+		}
+	}
+	else if (2 == argc)
+	{
+		// When this console application receives 2 arguments:
+		//	- argv[0] contains the full path to the executable file (i.e. ".exe") of this application
+		//  - argv[1] contains the help option
+		
+		PDDL::Identifier Option = argv[1];
+		if (("-h" == Option) || ("-help" == Option))
+		{
+			std::cout << std::endl
+				<< "The command-line for this application is:" << std::endl
+				<< "  \"Planner  a_PDDL_Domain_FileName  a_PDDL_Problem_Filename  [-b megabytes][-d][-e expansions][-g][-j threads][-m][-o][-p][-r][-s search][-t milliseconds]\"" << std::endl
+				<< "Option -b stops the search when it uses more megabytes (states, nodes and frontiers)." << std::endl
+				<< "Option -d stores the states of the search as deltas to their parents (less memory, more time), except with the hda searches." << std::endl
+				<< "Option -e stops the search after this number of expansions." << std::endl
+				<< "Option -g grounds the operators of the domain before search." << std::endl
+				<< "Option -j sets the number of threads of the parallel searches." << std::endl
+				<< "Option -m prints memory usage (domain, problem and search)." << std::endl
+				<< "Option -o disables the symmetry reduction (interchangeable objects) of the grounded searches." << std::endl
+				<< "Option -p disables the partial-order reduction (strong stubborn sets) of the grounded searches." << std::endl
+				<< "Option -r prints runtimes (reading of the domain and problem PDDL files, and search)." << std::endl
+				<< "Option -s selects the search: breadth (default), best, astar-hmax, astar-lmcut," << std::endl
+				<< "   gbfs-ff, iddfs, idastar-hmax, idastar-lmcut, bidirectional, parallel-breadth, hda-best," << std::endl
+				<< "   hdastar-hmax, hdastar-lmcut or portfolio." << std::endl
+				<< "Option -t stops the search after this number of milliseconds." << std::endl
+				<< "A search stopped by option -b, -e or -t prints the partial plan to the state closest to the goal." << std::endl
+				<< "This Planner accepts the following PDDL :requirements (in alphabetical order):" << std::endl
+				<< "   - :action-costs" << std::endl
+				<< "   - :negative-preconditions" << std::endl
+				<< "   - :strips" << std::endl
+				<< "   - :types (although types are accepted in a PDDL file, they are ignored)" << std::endl
+				<< std::endl;
+
+			return HELP;
+		}
+		else // (("-h" != Option) && ("-help" != Option))
+		{
+			std::cerr << "Option " << Option << " is unknown." << std::endl;
+
+			return ERROR_UNKNOWN_OPTION;
+		}
+	}
+	else // ((argc < 2) || (19 < argc))
+	{
+		std::cerr << "Incorrect number of arguments: " << (argc - 1) /* Don't count argv[0] */ << "." << std::endl;
+
+		std::cerr << std::endl
+			<< "The command-line for this application is:" << std::endl
+			<< "  \"Planner  a_PDDL_Domain_FileName  a_PDDL_Problem_Filename  [-b megabytes][-d][-e expansions][-g][-j threads][-m][-o][-p][-r][-s search][-t milliseconds]\"" << std::endl
+			<< "Option -b stops the search when it uses more megabytes (states, nodes and frontiers)." << std::endl
+			<< "Option -d stores the states of the search as deltas to their parents (less memory, more time), except with the hda searches." << std::endl
+			<< "Option -e stops the search after this number of expansions." << std::endl
+			<< "Option -g grounds the operators of the domain before search." << std::endl
+			<< "Option -j sets the number of threads of the parallel searches." << std::endl
+			<< "Option -m prints memory usage (domain, problem and search)." << std::endl
+			<< "Option -o disables the symmetry reduction (interchangeable objects) of the grounded searches." << std::endl
+			<< "Option -p disables the partial-order reduction (strong stubborn sets) of the grounded searches." << std::endl
+			<< "Option -r prints runtimes (reading of the domain and problem PDDL files, and search)." << std::endl
+			<< "Option -s selects the search: breadth (default), best, astar-hmax, astar-lmcut," << std::endl
+			<< "   gbfs-ff, iddfs, idastar-hmax, idastar-lmcut, bidirectional, parallel-breadth, hda-best," << std::endl
+			<< "   hdastar-hmax, hdastar-lmcut or portfolio." << std::endl
+			<< "Option -t stops the search after this number of milliseconds." << std::endl
+			<< "A search stopped by option -b, -e or -t prints the partial plan to the state closest to the goal." << std::endl
+			<< "This Planner accepts the following PDDL :requirements (in alphabetical order):" << std::endl
+			<< "   - :action-costs" << std::endl
+			<< "   - :negative-preconditions" << std::endl
+			<< "   - :strips" << std::endl
+			<< "   - :types (although this application accepts types in a PDDL file, they are ignored)" << std::endl
+			<< std::endl;
+
+		return ERROR_WRONG_NUMBER_OF_ARGUMENTS;
+	}
+}
+//
+//
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//
+//
 // =============================================================================================== End of file "main_BCP.cpp"
\ No newline at end of file
@@ -0,0 +1,51 @@
+// ================================================================================================ Beginning of file "BatchPlannerTest.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+// BatchPlanner solves the problems of a batch with 2 threads: an identical problem shares the result
+// of the first one, and a PDDL Problem file which cannot be read, or a search which runs out of
+// budget, gives no plan.
+//
+#ifndef _SPHG_PLANNER_BATCH_PLANNER_H
+	#include "BatchPlanner.h"
+#endif
+
+#include "UnitTesting.h"
+
+int main() {
+	Domain::StoreHouse aStoreHouse;
+	DomainFile aDomain("logistics.domain.pddl", aStoreHouse);
+
+	// The operators of logistics cost nothing: the cost of a breadth first plan is its length
+	BatchPlanner aBatch(aDomain, aStoreHouse, "breadth");
+	const BatchPlanner::HJob aFirstJob = aBatch.Add("logistics.problem.att_log3.1p.pddl");
+	const BatchPlanner::HJob aSecondJob = aBatch.Add("logistics.problem.att_log3.2p.pddl");
+	const BatchPlanner::HJob aMissingJob = aBatch.Add("missing.problem.pddl");
+	const BatchPlanner::HJob aDuplicateJob = aBatch.Add("logistics.problem.att_log3.1p.pddl");
+	aBatch.Run(2);
+
+	const BatchPlanner::Result& aFirst = aBatch.GettheResult(aFirstJob);
+	Check(aFirst.thePlanIsFound && !aFirst.theResultIsShared, "The first job is searched and solved");
+	Check(!aFirst.thePlan.empty() && (aFirst.theCost == (PDDL::Number) aFirst.thePlan.size()), "The breadth first search costs its plan");
+	Check(aBatch.GettheResult(aSecondJob).thePlanIsFound && !aBatch.GettheResult(aSecondJob).theResultIsShared, "The second job is searched and solved");
+
+	const BatchPlanner::Result& aMissing = aBatch.GettheResult(aMissingJob);
+	Check(aMissing.theReadingFailed && !aMissing.thePlanIsFound && aMissing.thePlan.empty(), "A missing PDDL Problem file gives no plan");
+
+	const BatchPlanner::Result& aDuplicate = aBatch.GettheResult(aDuplicateJob);
+	Check(aDuplicate.thePlanIsFound && aDuplicate.theResultIsShared && (0 == aDuplicate.theExpansions), "An identical problem is not searched again");
+	Check((aDuplicate.thePlan == aFirst.thePlan) && (aDuplicate.theCost == aFirst.theCost), "An identical problem shares the plan of the first one");
+
+	// One expansion is not enough to solve this problem
+	StateSpaceForwardChaining::Budget aBudget;
+	aBudget.theExpansions = 1;
+	BatchPlanner aBudgetedBatch(aDomain, aStoreHouse, "astar-lmcut");
+	aBudgetedBatch.SetBudget(aBudget);
+	const BatchPlanner::HJob aBudgetedJob = aBudgetedBatch.Add("logistics.problem.att_log3.5p.pddl");
+	aBudgetedBatch.Run(2);
+	Check(!aBudgetedBatch.GettheResult(aBudgetedJob).thePlanIsFound, "A search out of budget gives no plan");
+	Check(StateSpaceForwardChaining::SEARCH_BUDGET_EXHAUSTED == aBudgetedBatch.GettheResult(aBudgetedJob).theStatus, "A search out of budget tells it");
+
+	std::cout << "BatchPlannerTest: " << theFailedChecks << " failed check(s)" << std::endl;
+	return theFailedChecks;
+}
+// ================================================================================================ End of file "BatchPlannerTest.cpp"
@@ -0,0 +1,77 @@
+// ================================================================================================ Beginning of file "PlanCacheTest.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+// PlanCache finds the plan of a problem read again without searching, makes the same key from
+// several threads at once without changing the Problem, and evicts its least recently used plans.
+//
+#include <thread>		// Visibility for std::thread
+
+#ifndef _SPHG_PLANNER_PLAN_CACHE_H
+	#include "PlanCache.h"
+#endif
+
+#include "UnitTesting.h"
+
+int main() {
+	PlanCache aCache(16, 1024 * 1024);
+	std::string aFirstKey;
+	EXTERNAL_TYPES::plan aFirstPlan;
+	PDDL::Number aFirstCost = 0;
+	for (unsigned int r = 0; r < 2; ++r)
+	{
+		// Each round reads the files again, as a new request would
+		Domain::StoreHouse aStoreHouse;
+		DomainFile aDomain("logistics.domain.pddl", aStoreHouse);
+		ProblemFile aProblem("logistics.problem.att_log3.2p.pddl", aStoreHouse, aDomain.ReadingFailed());
+		const Domain::HProblem aProblemHandle = aDomain.AddProblem(aProblem);
+		const std::string aKey = PlanCache::MaketheKey(aDomain, aProblemHandle);
+		Check((std::string::npos == aKey.find("#")) && (std::string::npos == aKey.find("( ")), "The key names every predicate and constant");
+
+		EXTERNAL_TYPES::plan aPlan;
+		PDDL::Number aCost = 0;
+		if (0 == r)
+		{
+			Check(!aCache.Find(aKey, aPlan, aCost), "An empty cache misses");
+			StateSpaceForwardChaining aSearch(aDomain, aProblemHandle);
+			Check(aSearch.BestFirst(), "BestFirst/0 finds a plan");
+			aSearch.ConvertthePlanFound(aFirstPlan);
+			aFirstCost = aSearch.GettheCostOfthePlanFound();
+			aCache.Insert(aKey, aFirstPlan, aFirstCost);
+			aFirstKey = aKey;
+
+			// Several threads make the key of the same Problem at once
+			const std::map<PDDL::HIdentifier, PDDL::Identifier>::size_type theConstants = aDomain.GettheProblem(aProblemHandle)->GettheConstants().size();
+			std::string someKeys[4];
+			std::vector<std::thread> someThreads;
+			for (unsigned int t = 0; t < 4; ++t)
+				someThreads.push_back(std::thread([&, t]() { someKeys[t] = PlanCache::MaketheKey(aDomain, aProblemHandle); }));
+			for (unsigned int t = 0; t < 4; ++t)
+				someThreads[t].join();
+			for (unsigned int t = 0; t < 4; ++t)
+				Check(aKey == someKeys[t], "Each thread makes the same key");
+			Check(theConstants == aDomain.GettheProblem(aProblemHandle)->GettheConstants().size(), "Making a key does not change the Problem");
+		}
+		else
+		{
+			Check(aFirstKey == aKey, "A problem read again has the same key");
+			Check(aCache.Find(aKey, aPlan, aCost), "A problem read again hits");
+			Check((aFirstPlan == aPlan) && (aFirstCost == aCost), "A hit copies the plan stored and its cost");
+		}
+	}
+	Check((1 == aCache.GettheHits()) && (1 == aCache.GettheMisses()) && (1 == aCache.Size()), "The cache counts its hits and misses");
+
+	// The least recently used plan is evicted first
+	PlanCache aSmallCache(2, 1024 * 1024);
+	EXTERNAL_TYPES::plan aPlan(1);
+	PDDL::Number aCost = 0;
+	aSmallCache.Insert("a", aPlan, 1);
+	aSmallCache.Insert("b", aPlan, 2);
+	Check(aSmallCache.Find("a", aPlan, aCost) && (1 == aCost), "A plan stored is found");
+	aSmallCache.Insert("c", aPlan, 3);
+	Check(aSmallCache.Find("a", aPlan, aCost) && aSmallCache.Find("c", aPlan, aCost) && !aSmallCache.Find("b", aPlan, aCost), "The least recently used plan is evicted");
+	Check((1 == aSmallCache.GettheEvictions()) && (2 == aSmallCache.Size()), "The cache counts its evictions");
+
+	std::cout << "PlanCacheTest: " << theFailedChecks << " failed check(s)" << std::endl;
+	return theFailedChecks;
+}
+// ================================================================================================ End of file "PlanCacheTest.cpp"
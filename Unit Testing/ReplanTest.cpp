@@ -0,0 +1,60 @@
+// ================================================================================================ Beginning of file "ReplanTest.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+// Replan/2 after the initial state of a solved problem is perturbed by the application of some of
+// its applicable actions: the repaired plan must be valid from the perturbed initial state. Deleting
+// a static predicate cannot be repaired: Replan/2 then asks for a new search.
+//
+#include "UnitTesting.h"
+
+int main() {
+	Domain::StoreHouse aStoreHouse;
+	DomainFile aDomain("logistics.domain.pddl", aStoreHouse);
+	ProblemFile aProblem("logistics.problem.att_log3.5p.pddl", aStoreHouse, aDomain.ReadingFailed());
+	StateSpaceForwardChaining aSearch(aDomain, aDomain.AddProblem(aProblem));
+	aSearch.Ground();
+	Check(aSearch.BestFirst() && IsValid(aSearch, aSearch.GettheInitialState()), "BestFirst/0 finds a valid plan");
+
+	// An unchanged initial state keeps the previous plan
+	const State none;
+	const Operator::HOperatorSignatures thePreviousPlan(*aSearch.GetthePlanFound()->GettheOperatorSignatures());
+	Check(aSearch.Replan(none, none) && IsValid(aSearch, aSearch.GettheInitialState()), "Replan/2 keeps a valid plan");
+	Check(*aSearch.GetthePlanFound()->GettheOperatorSignatures() == thePreviousPlan, "Replan/2 keeps the previous plan");
+	Check(StateSpaceForwardChaining::SEARCH_COMPLETED == aSearch.GettheStatus(), "Replan/2 completes");
+
+	// Deleting a static predicate (e.g. a city of a place) cannot be repaired: a new search is needed
+	State aStaticPredicate;
+	aStaticPredicate.insert((PDDL::HPredicate) aSearch.GettheStaticPredicates().first());
+	const State anInitialState(aSearch.GettheInitialState());
+	Check(!aSearch.Replan(none, aStaticPredicate), "Replan/2 cannot delete a static predicate");
+	Check(StateSpaceForwardChaining::SEARCH_NEEDS_RESTART == aSearch.GettheStatus(), "Replan/2 asks for a new search");
+	Check(aSearch.GettheInitialState() == anInitialState, "Replan/2 does not change the initial state when it asks for a new search");
+
+	// Perturb the initial state with its k-th applicable action, then repair
+	const GroundedActions& someActions = aSearch.GettheGroundedActions();
+	for (GroundedActions::size_type k = 0; k < 8; ++k)
+	{
+		const State aPreviousState(aSearch.GettheInitialState());
+		GroundedActions::size_type a = 0;
+		for (GroundedActions::size_type n = 0; a < someActions.size(); ++a)
+			if (someActions[a].IsApplicableTo(aPreviousState) && (k == n++))
+				break;
+		if (someActions.size() == a)
+			break;
+
+		State aPerturbedState(aPreviousState);
+		someActions[a].Apply(aPerturbedState);
+		State someAdditions(aPerturbedState);
+		someAdditions.remove(aPreviousState);
+		State someDeletions(aPreviousState);
+		someDeletions.remove(aPerturbedState);
+
+		Check(aSearch.Replan(someAdditions, someDeletions), "Replan/2 repairs the plan");
+		Check(aSearch.GettheInitialState() == aPerturbedState, "Replan/2 searches from the perturbed initial state");
+		Check(IsValid(aSearch, aPerturbedState), "The repaired plan is valid from the perturbed initial state");
+	}
+
+	std::cout << "ReplanTest: " << theFailedChecks << " failed check(s)" << std::endl;
+	return theFailedChecks;
+}
+// ================================================================================================ End of file "ReplanTest.cpp"
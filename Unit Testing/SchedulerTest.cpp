@@ -0,0 +1,108 @@
+// ================================================================================================ Beginning of file "SchedulerTest.cpp"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+// Scheduler interleaves two searches of the same problem, one slice at a time, within the budget of
+// each tick: no slice starts once the budget ran out, and both searches end with the plan they find
+// when they run alone.
+//
+#include <chrono>		// Visibility for std::chrono::steady_clock
+#include <thread>		// Visibility for std::thread
+
+#ifndef _SPHG_PLANNER_RUN_SEARCH_H
+	#include "RunSearch.h"
+#endif
+
+#ifndef _SPHG_PLANNER_SCHEDULER_H
+	#include "Scheduler.h"
+#endif
+
+#include "UnitTesting.h"
+
+int main() {
+	Domain::StoreHouse aStoreHouse;
+	DomainFile aDomain("logistics.domain.pddl", aStoreHouse);
+	ProblemFile aProblem("logistics.problem.att_log3.5p.pddl", aStoreHouse, aDomain.ReadingFailed());
+	const Domain::HProblem aProblemHandle = aDomain.AddProblem(aProblem);
+	const char* someSearches[] = { "astar-hmax", "gbfs-ff" };
+
+	// Each search alone, stepped one expansion at a time: the longest slice bounds how much a tick may
+	// overrun its budget, as a query is stepped only when the tick has time left
+	long long aLongestSlice = 0;
+	PDDL::Number someCosts[2];
+	for (unsigned int q = 0; q < 2; ++q)
+	{
+		StateSpaceForwardChaining aSearch(aDomain, aProblemHandle);
+		aSearch.Ground();
+		Heuristic* aHeuristic = MaketheHeuristic(someSearches[q], aSearch.GettheGroundedActions(), aSearch.GettheFinalState());
+		bool aPlanIsFound = StartSearch(aSearch, someSearches[q], aHeuristic);
+		while (StateSpaceForwardChaining::SEARCH_IN_PROGRESS == aSearch.GettheStatus())
+		{
+			const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+			if (aSearch.Step(1))
+				aPlanIsFound = true;
+			const long long aSlice = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStart).count();
+			if (aLongestSlice < aSlice)
+				aLongestSlice = aSlice;
+		}
+		Check(aPlanIsFound, "The search alone finds a plan");
+		someCosts[q] = aSearch.GettheCostOfthePlanFound();
+		delete aHeuristic;
+	}
+
+	// The second thread of a tick is started and joined after the end of the tick at worst
+	long long aLongestThread = 0;
+	for (unsigned int t = 0; t < 100; ++t)
+	{
+		const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+		std::thread aThread([] {});
+		aThread.join();
+		const long long aThreadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStart).count();
+		if (aLongestThread < aThreadTime)
+			aLongestThread = aThreadTime;
+	}
+
+	// A tick without budget steps no query
+	Scheduler anIdleScheduler(aDomain, 0, 1);
+	const Scheduler::HQuery anIdleQuery = anIdleScheduler.Add(aProblemHandle, someSearches[0]);
+	anIdleScheduler.Tick(2);
+	Check(anIdleScheduler.IsPending(anIdleQuery) && (0 == anIdleScheduler.GettheSSFC(anIdleQuery).GettheExpansions()), "A tick steps no query once its budget ran out");
+
+	// Ticks of 100 microseconds, and slices of 1 expansion: one tick cannot solve the problem
+	const INTERNAL_TYPES::u64 aTickBudget = 100;
+	Scheduler aScheduler(aDomain, aTickBudget, 1);
+	const Scheduler::HQuery aFirstQuery = aScheduler.Add(aProblemHandle, someSearches[0]);
+	const Scheduler::HQuery aSecondQuery = aScheduler.Add(aProblemHandle, someSearches[1]);
+	Check((Scheduler::NO_QUERY != aFirstQuery) && (Scheduler::NO_QUERY != aSecondQuery), "Both searches are scheduled");
+	Check((Scheduler::NO_QUERY == aScheduler.Add(aProblemHandle, "iddfs")), "A search which cannot be stepped is not scheduled");
+
+	bool theSearchesAreInterleaved = false;
+	long long aLongestTick = 0;
+	for (bool aQueryIsPending = true; aQueryIsPending; )
+	{
+		const std::chrono::steady_clock::time_point aStart = std::chrono::steady_clock::now();
+		aQueryIsPending = aScheduler.Tick(2);
+		const long long aTick = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStart).count();
+		if (aLongestTick < aTick)
+			aLongestTick = aTick;
+		if (aScheduler.IsPending(aFirstQuery) && aScheduler.IsPending(aSecondQuery)
+			&& (0 < aScheduler.GettheSSFC(aFirstQuery).GettheExpansions()) && (0 < aScheduler.GettheSSFC(aSecondQuery).GettheExpansions()))
+			theSearchesAreInterleaved = true;
+	}
+	Check(1 < aScheduler.GettheTicks(), "The searches take more than one tick");
+	Check(aLongestTick <= (long long) aTickBudget + aLongestSlice + aLongestThread, "Each tick overruns its budget by a slice and a thread at most");
+	Check(theSearchesAreInterleaved, "Both searches progress before either ends");
+	Check(2 == aScheduler.GettheNumberOfLatencies(), "The latency of both searches is recorded");
+
+	// Each scheduled search ends as the same search run alone
+	const Scheduler::HQuery someQueries[] = { aFirstQuery, aSecondQuery };
+	for (unsigned int q = 0; q < 2; ++q)
+	{
+		StateSpaceForwardChaining& aScheduledSearch = aScheduler.GettheSSFC(someQueries[q]);
+		Check(aScheduler.IsPlanFound(someQueries[q]) && IsValid(aScheduledSearch, aScheduledSearch.GettheInitialState()), "A scheduled search finds a valid plan");
+		Check(someCosts[q] == aScheduledSearch.GettheCostOfthePlanFound(), "A scheduled search finds the plan of the search alone");
+	}
+
+	std::cout << "SchedulerTest: " << theFailedChecks << " failed check(s)" << std::endl;
+	return theFailedChecks;
+}
+// ================================================================================================ End of file "SchedulerTest.cpp"
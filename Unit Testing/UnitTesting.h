@@ -0,0 +1,65 @@
+// ================================================================================================ Beginning of file "UnitTesting.h"
+// Copyright (c) 2012-2019, Eric Jacopin, ejacopin@ymail.com
+// ------------------------------------------------------------------------------------------------
+#ifndef _SPHG_PLANNER_UNIT_TESTING_H
+#define _SPHG_PLANNER_UNIT_TESTING_H
+
+#if defined(_MSC_VER)	// _MSC_VER reports the major and minor versions of the Microsoft C++ compiler
+	#pragma once		// When compiling, this file will be included (opened) only once by the Microsoft C++ compiler 
+#endif					// _MSC_VER
+
+// ------------------------------------------------------------------------------------------------ Inclusion of files
+// STD and STL files
+#include <iostream>		// Visibility for std::cout, std::endl
+
+// Project files
+#ifndef _SPHG_PLANNER_CONDITIONAL_COMPILING_H
+	#include "ConditionalCompiling.h"
+#endif
+
+#ifndef _SPHG_PDDL_DOMAIN_FILE_H
+	#include "DomainFile.h"
+#endif
+
+#ifndef _SPHG_PDDL_PROBLEM_FILE_H
+	#include "ProblemFile.h"
+#endif
+
+#ifndef _SPHG_PLANNER_SEARCH_SSFC_H
+	#include "StateSpaceForwardChaining.h"
+#endif
+
+// ------------------------------------------------------------------------------------------------ Testing functions
+// Each test is a program run from the "PDDL Testing" folder: it tells each failed check and returns the number of failed checks
+static int theFailedChecks = 0;
+
+inline void Check(bool aCondition, const char* aCheck) {
+	if (!aCondition)
+	{
+		++theFailedChecks;
+		std::cout << "FAILED: " << aCheck << std::endl;
+	}
+}
+
+// Replay the grounded actions of the plan found from anInitialState: are they applicable, do they reach the goal and cost the cost of the plan found?
+inline bool IsValid(const StateSpaceForwardChaining& aSearch, const State& anInitialState) {
+	const GroundedActions& someActions = aSearch.GettheGroundedActions();
+	const Operator::HOperatorSignatures& somePlan = *aSearch.GetthePlanFound()->GettheOperatorSignatures();
+	State aState(anInitialState);
+	PDDL::Number aCost = 0.0f;
+	for (Operator::HOperatorSignatures::size_type o = 0; o < somePlan.size(); ++o)
+	{
+		GroundedActions::size_type a = 0;
+		while ((a < someActions.size()) && (someActions[a].GettheOperatorSignature() != somePlan[o]))
+			++a;
+		if ((someActions.size() == a) || !someActions[a].IsApplicableTo(aState))
+			return false;
+		someActions[a].Apply(aState);
+		aCost += 1 + someActions[a].GettheCost();	// 1 operator has been added: Add 1 to the cost of this plan, as CostExpand/0 does
+	}
+
+	return aState.includes(aSearch.GettheFinalState()) && (aCost == aSearch.GettheCostOfthePlanFound());
+}
+
+#endif // _SPHG_PLANNER_UNIT_TESTING_H
+// ================================================================================================ End of file "UnitTesting.h"